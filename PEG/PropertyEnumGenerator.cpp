@@ -382,6 +382,7 @@ void PropertySetCode::generateCppFile(TextStreamIndent &s) const
 					   .arg(name);
 	s.newLine() << QString("setName(%1_name);").arg(name);
 	assignmentsSetCode("", assignments, setExceptions, s);
+	s.newLine() << "internMetadata();";
 	generateChildrenAssignment(s);
 	s.delIndent();
 	s.newLine() << "}";
@@ -457,6 +458,7 @@ void PropertySetCode::generateChildrenAssignment(TextStreamIndent &s) const
 						   .arg(p->name);
 		s.newLine() << QString("%1.setName(%1_name);").arg(p->name);
 		assignmentsSetCode(p->name, p->assignments, setExceptions, s);
+		s.newLine() << QString("%1.internMetadata();").arg(p->name);
 	}
 	s.popWrapperLines();
 }
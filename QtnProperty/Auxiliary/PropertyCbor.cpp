@@ -0,0 +1,96 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#include "PropertyCbor.h"
+
+#ifdef QTN_CBOR_SUPPORT
+
+bool qtnCborReadValue(QCborStreamReader &reader, bool &value)
+{
+	if (!reader.isBool())
+		return false;
+
+	value = reader.toBool();
+	return reader.next();
+}
+
+bool qtnCborReadValue(QCborStreamReader &reader, qint64 &value)
+{
+	if (reader.isUnsignedInteger())
+		value = qint64(reader.toUnsignedInteger());
+	else if (reader.isNegativeInteger())
+		value = reader.toInteger();
+	else
+		return false;
+
+	return reader.next();
+}
+
+bool qtnCborReadValue(QCborStreamReader &reader, quint64 &value)
+{
+	if (!reader.isUnsignedInteger())
+		return false;
+
+	value = reader.toUnsignedInteger();
+	return reader.next();
+}
+
+bool qtnCborReadValue(QCborStreamReader &reader, double &value)
+{
+	if (reader.isDouble())
+		value = reader.toDouble();
+	else if (reader.isFloat())
+		value = double(reader.toFloat());
+	else if (reader.isFloat16())
+		value = double(reader.toFloat16());
+	else if (reader.isUnsignedInteger())
+		value = double(reader.toUnsignedInteger());
+	else if (reader.isNegativeInteger())
+		value = double(reader.toInteger());
+	else
+		return false;
+
+	return reader.next();
+}
+
+bool qtnCborReadValue(QCborStreamReader &reader, QString &value)
+{
+	if (!reader.isString())
+		return false;
+
+	value.clear();
+	auto chunk = reader.readString();
+	while (chunk.status == QCborStreamReader::Ok)
+	{
+		value += chunk.data;
+		chunk = reader.readString();
+	}
+
+	return chunk.status == QCborStreamReader::EndOfString;
+}
+
+bool qtnCborLeaveContainer(QCborStreamReader &reader)
+{
+	while (reader.hasNext())
+	{
+		if (!reader.next())
+			return false;
+	}
+
+	return reader.leaveContainer();
+}
+
+#endif
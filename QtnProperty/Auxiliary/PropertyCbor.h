@@ -0,0 +1,81 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+
+#ifdef QTN_CBOR_SUPPORT
+
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
+
+#include <type_traits>
+
+// Scalar readers return false without consuming the current element
+// if it has unexpected type, otherwise the element is consumed.
+QTN_IMPORT_EXPORT bool qtnCborReadValue(
+	QCborStreamReader &reader, bool &value);
+QTN_IMPORT_EXPORT bool qtnCborReadValue(
+	QCborStreamReader &reader, qint64 &value);
+QTN_IMPORT_EXPORT bool qtnCborReadValue(
+	QCborStreamReader &reader, quint64 &value);
+QTN_IMPORT_EXPORT bool qtnCborReadValue(
+	QCborStreamReader &reader, double &value);
+QTN_IMPORT_EXPORT bool qtnCborReadValue(
+	QCborStreamReader &reader, QString &value);
+
+// Skips the rest of the current container and leaves it
+QTN_IMPORT_EXPORT bool qtnCborLeaveContainer(QCborStreamReader &reader);
+
+template <typename T>
+using QtnCborNumberType = typename std::conditional<std::is_integral<T>::value,
+	qint64, double>::type;
+
+// Reads array of exactly count numbers. Array is always consumed.
+template <typename T>
+bool qtnCborReadArray(QCborStreamReader &reader, T *values, int count)
+{
+	Q_ASSERT(reader.isArray());
+	if (!reader.enterContainer())
+		return false;
+
+	int i = 0;
+	for (; i < count && reader.hasNext(); ++i)
+	{
+		QtnCborNumberType<T> value;
+		if (!qtnCborReadValue(reader, value))
+			break;
+
+		values[i] = T(value);
+	}
+
+	bool ok = (i == count) && !reader.hasNext();
+	return qtnCborLeaveContainer(reader) && ok;
+}
+
+template <typename T>
+void qtnCborWriteArray(QCborStreamWriter &writer, const T *values, int count)
+{
+	writer.startArray(quint64(count));
+	for (int i = 0; i < count; ++i)
+	{
+		writer.append(QtnCborNumberType<T>(values[i]));
+	}
+	writer.endArray();
+}
+
+#endif
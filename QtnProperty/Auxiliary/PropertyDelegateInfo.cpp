@@ -19,6 +19,73 @@ limitations under the License.
 #include "QtnProperty/PropertyDelegateAttrs.h"
 #include "PropertyMacro.h"
 
+#include <QHash>
+#include <QMutex>
+
+namespace
+{
+struct QtnDelegateAttributeRegistry
+{
+	QtnDelegateAttributeRegistry();
+
+	int registerName(const QByteArray &name);
+
+	QMutex mutex;
+	QHash<QByteArray, int> ids;
+	QVector<QByteArray> names;
+};
+
+QtnDelegateAttributeRegistry::QtnDelegateAttributeRegistry()
+{
+	// same order as in QtnDelegateAttributeId
+	static QByteArray (*const builtIn[])() = { qtnSuffixAttr, qtnMinAttr,
+		qtnMaxAttr, qtnStepAttr, qtnMultiplierAttr, qtnPrecisionAttr,
+		qtnMultiLineEditAttr, qtnMaxLengthAttr, qtnPlaceholderAttr,
+		qtnLabelFalseAttr, qtnLabelTrueAttr, qtnFillColorAttr,
+		qtnLiveUpdateAttr, qtnDrawBorderAttr, qtnUpdateByScrollAttr,
+		qtnAnimateAttr, qtnToolTipAttr, qtnDrawTextAttr };
+	Q_STATIC_ASSERT(
+		sizeof(builtIn) / sizeof(builtIn[0]) == QtnBuiltInAttrIdCount);
+
+	for (auto attrName : builtIn)
+	{
+		registerName(attrName());
+	}
+}
+
+int QtnDelegateAttributeRegistry::registerName(const QByteArray &name)
+{
+	auto it = ids.constFind(name);
+	if (it != ids.constEnd())
+		return it.value();
+
+	int id = names.size();
+	names.append(name);
+	ids.insert(name, id);
+	return id;
+}
+
+QtnDelegateAttributeRegistry &qtnDelegateAttributeRegistry()
+{
+	static QtnDelegateAttributeRegistry registry;
+	return registry;
+}
+} // namespace
+
+int qtnDelegateAttributeId(const QByteArray &name)
+{
+	auto &registry = qtnDelegateAttributeRegistry();
+	QMutexLocker locker(&registry.mutex);
+	return registry.registerName(name);
+}
+
+QByteArray qtnDelegateAttributeName(int attributeId)
+{
+	auto &registry = qtnDelegateAttributeRegistry();
+	QMutexLocker locker(&registry.mutex);
+	return registry.names.value(attributeId);
+}
+
 QtnPropertyDelegateInfo::QtnPropertyDelegateInfo(
 	const QtnPropertyDelegateInfo &other)
 	: name(other.name)
@@ -33,6 +100,104 @@ QtnPropertyDelegateInfo::QtnPropertyDelegateInfo(
 {
 }
 
+QtnPropertyDelegateInfo &QtnPropertyDelegateInfo::operator=(
+	const QtnPropertyDelegateInfo &other)
+{
+	// a copy is never interned
+	name = other.name;
+	attributes = other.attributes;
+	m_attributesById.clear();
+	m_interned = false;
+	return *this;
+}
+
+QtnPropertyDelegateInfo::Ptr QtnPropertyDelegateInfo::interned() const
+{
+	static QMutex mutex;
+	static QMultiHash<uint, Ptr> pool;
+	static int purgeSize = 64;
+
+	uint hash = qHash(*this);
+
+	QMutexLocker locker(&mutex);
+
+	for (auto it = pool.constFind(hash);
+		 it != pool.constEnd() && it.key() == hash; ++it)
+	{
+		if (*it.value() == *this)
+			return it.value();
+	}
+
+	// drop infos nobody refers to except the pool
+	if (pool.size() >= purgeSize)
+	{
+		for (auto it = pool.begin(); it != pool.end();)
+		{
+			if (it.value().use_count() == 1)
+				it = pool.erase(it);
+			else
+				++it;
+		}
+
+		purgeSize = qMax(64, pool.size() * 2);
+	}
+
+	auto result = std::make_shared<QtnPropertyDelegateInfo>(*this);
+	result->m_interned = true;
+	for (auto it = result->attributes.cbegin();
+		 it != result->attributes.cend(); ++it)
+	{
+		int id = qtnDelegateAttributeId(it.key());
+		if (id >= result->m_attributesById.size())
+			result->m_attributesById.resize(id + 1);
+
+		result->m_attributesById[id] = &it.value();
+	}
+
+	pool.insert(hash, result);
+	return result;
+}
+
+const QVariant *QtnPropertyDelegateInfo::attribute(int attributeId) const
+{
+	if (m_interned)
+	{
+		if (attributeId < 0 || attributeId >= m_attributesById.size())
+			return nullptr;
+
+		return m_attributesById.at(attributeId);
+	}
+
+	auto it = attributes.constFind(qtnDelegateAttributeName(attributeId));
+	if (it == attributes.constEnd())
+		return nullptr;
+
+	return &it.value();
+}
+
+bool QtnPropertyDelegateInfo::operator==(
+	const QtnPropertyDelegateInfo &other) const
+{
+	if (this == &other)
+		return true;
+
+	return name == other.name && attributes == other.attributes;
+}
+
+uint qHash(const QtnPropertyDelegateInfo &info, uint seed)
+{
+	// QVariant has no qHash, values are hashed by type and string form
+	seed = qHash(info.name, seed);
+	for (auto it = info.attributes.cbegin(); it != info.attributes.cend();
+		 ++it)
+	{
+		seed = 31 * seed + qHash(it.key()) +
+			qHash(it.value().toString()) + uint(it.value().userType());
+	}
+
+	return seed;
+}
+
 QByteArray qtnComboBoxDelegate()
 {
 	return QByteArrayLiteral("ComboBox");
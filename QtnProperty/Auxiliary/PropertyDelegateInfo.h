@@ -21,6 +21,14 @@ limitations under the License.
 #include "QtnProperty/Config.h"
 #include <QMap>
 #include <QVariant>
+#include <QVector>
+
+#include <memory>
+
+// Attribute names are registered once and get small integer ids,
+// built-in attributes have ids of QtnDelegateAttributeId.
+QTN_IMPORT_EXPORT int qtnDelegateAttributeId(const QByteArray &name);
+QTN_IMPORT_EXPORT QByteArray qtnDelegateAttributeName(int attributeId);
 
 struct QTN_IMPORT_EXPORT QtnPropertyDelegateInfo
 {
@@ -32,6 +40,41 @@ struct QTN_IMPORT_EXPORT QtnPropertyDelegateInfo
 	QtnPropertyDelegateInfo(const QtnPropertyDelegateInfo &other);
 	QtnPropertyDelegateInfo(
 		const QByteArray &name, const Attributes &attributes = Attributes());
+	QtnPropertyDelegateInfo &operator=(const QtnPropertyDelegateInfo &other);
+
+	using Ptr = std::shared_ptr<const QtnPropertyDelegateInfo>;
+
+	// Returns immutable info shared by all equal interned infos.
+	// Attributes of interned info are indexed by attribute id.
+	Ptr interned() const;
+	inline bool isInterned() const;
+
+	// nullptr if there is no such attribute
+	const QVariant *attribute(int attributeId) const;
+	inline QVariant attributeValue(int attributeId) const;
+
+	template <typename T>
+	inline T getAttribute(int attributeId, const T &defaultValue = T()) const
+	{
+		auto value = attribute(attributeId);
+
+		if (!value)
+			return defaultValue;
+
+		return value->value<T>();
+	}
+
+	template <typename T>
+	inline bool loadAttribute(int attributeId, T &to) const
+	{
+		auto value = attribute(attributeId);
+
+		if (!value)
+			return false;
+
+		to = value->value<T>();
+		return true;
+	}
 
 	template <typename T>
 	inline T getAttribute(
@@ -64,8 +107,36 @@ struct QTN_IMPORT_EXPORT QtnPropertyDelegateInfo
 		Q_ASSERT(to);
 		(to->*set)(getAttribute(name, (to->*get)()));
 	}
+
+	bool operator==(const QtnPropertyDelegateInfo &other) const;
+	inline bool operator!=(const QtnPropertyDelegateInfo &other) const;
+
+private:
+	// values of attributes by attribute id, only for interned info
+	QVector<const QVariant *> m_attributesById;
+	bool m_interned = false;
 };
 
+QTN_IMPORT_EXPORT uint qHash(
+	const QtnPropertyDelegateInfo &info, uint seed = 0);
+
+bool QtnPropertyDelegateInfo::isInterned() const
+{
+	return m_interned;
+}
+
+QVariant QtnPropertyDelegateInfo::attributeValue(int attributeId) const
+{
+	auto value = attribute(attributeId);
+	return value ? *value : QVariant();
+}
+
+bool QtnPropertyDelegateInfo::operator!=(
+	const QtnPropertyDelegateInfo &other) const
+{
+	return !operator==(other);
+}
+
 struct QTN_IMPORT_EXPORT QtnSubPropertyInfo
 {
 	int id;
@@ -0,0 +1,90 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#include "PropertyEnumRegistry.h"
+
+#include <QMutex>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using EnumInfoPtr = std::shared_ptr<const QtnEnumInfo>;
+using Snapshot = std::vector<EnumInfoPtr>;
+
+struct QtnEnumRegistryData
+{
+	QMutex mutex;
+	std::vector<QtnEnumRegistry::Factory> factories;
+	// enum infos replaced by retranslate()
+	std::vector<EnumInfoPtr> retired;
+	// published with atomic operations, never modified
+	std::shared_ptr<const Snapshot> snapshot;
+};
+} // namespace
+
+static QtnEnumRegistryData &registry()
+{
+	static QtnEnumRegistryData result;
+	return result;
+}
+
+int QtnEnumRegistry::registerEnum(const Factory &factory)
+{
+	Q_ASSERT(factory);
+
+	auto &r = registry();
+	QMutexLocker locker(&r.mutex);
+
+	auto snapshot = std::atomic_load(&r.snapshot);
+	auto newSnapshot =
+		std::make_shared<Snapshot>(snapshot ? *snapshot : Snapshot());
+	newSnapshot->push_back(std::make_shared<const QtnEnumInfo>(factory()));
+	r.factories.push_back(factory);
+
+	std::atomic_store(
+		&r.snapshot, std::shared_ptr<const Snapshot>(std::move(newSnapshot)));
+	return int(r.factories.size()) - 1;
+}
+
+const QtnEnumInfo &QtnEnumRegistry::enumInfo(int id)
+{
+	auto snapshot = std::atomic_load(&registry().snapshot);
+	Q_ASSERT(snapshot);
+	Q_ASSERT(id >= 0 && id < int(snapshot->size()));
+	return *snapshot->at(size_t(id));
+}
+
+void QtnEnumRegistry::retranslate()
+{
+	auto &r = registry();
+	QMutexLocker locker(&r.mutex);
+
+	auto snapshot = std::atomic_load(&r.snapshot);
+	if (!snapshot)
+		return;
+
+	auto newSnapshot = std::make_shared<Snapshot>();
+	newSnapshot->reserve(r.factories.size());
+	for (auto &factory : r.factories)
+		newSnapshot->push_back(std::make_shared<const QtnEnumInfo>(factory()));
+
+	r.retired.insert(r.retired.end(), snapshot->begin(), snapshot->end());
+	std::atomic_store(
+		&r.snapshot, std::shared_ptr<const Snapshot>(std::move(newSnapshot)));
+}
@@ -0,0 +1,41 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+#include "QtnProperty/Enum.h"
+
+#include <functional>
+
+// Registry of immutable enum infos for built-in enums, like Qt::PenStyle.
+// Enum infos are built with current translations and rebuilt together by
+// retranslate(), which qtnPropertyInstallTranslations calls.
+// Reading is lock-free and safe from any thread. Replaced enum infos are
+// kept alive, so references taken before retranslate() stay valid.
+class QTN_IMPORT_EXPORT QtnEnumRegistry
+{
+public:
+	using Factory = std::function<QtnEnumInfo()>;
+
+	// Builds enum info with factory and returns its id.
+	// Factory should not access the registry.
+	static int registerEnum(const Factory &factory);
+	static const QtnEnumInfo &enumInfo(int id);
+
+	static void retranslate();
+};
@@ -0,0 +1,175 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#include "PropertyMemoryUsage.h"
+#include "PropertyDelegateInfo.h"
+
+#include <QTextStream>
+
+qint64 QtnMemoryUsage::totalBytes() const
+{
+	qint64 result = 0;
+	for (auto &counter : m_categories)
+		result += counter.bytes;
+
+	return result;
+}
+
+void QtnMemoryUsage::add(Category category, qint64 bytes, qint64 count)
+{
+	Q_ASSERT(category >= 0 && category < CategoryCount);
+	auto &counter = m_categories[category];
+	counter.bytes += bytes;
+	counter.count += count;
+}
+
+void QtnMemoryUsage::addProperty(
+	const char *className, qint64 bytes, qint64 count)
+{
+	add(Properties, bytes, count);
+
+	auto &counter = m_propertyClasses[QByteArray(className)];
+	counter.bytes += bytes;
+	counter.count += count;
+}
+
+bool QtnMemoryUsage::addShared(
+	Category category, const void *data, qint64 bytes)
+{
+	if (!data || m_sharedData.contains(data))
+		return false;
+
+	m_sharedData.insert(data);
+	add(category, bytes);
+	return true;
+}
+
+void QtnMemoryUsage::addString(const QString &str)
+{
+	if (str.isNull())
+		return;
+
+	addShared(Strings, str.constData(),
+		qint64(sizeof(QArrayData)) +
+			qint64(str.capacity() + 1) * qint64(sizeof(QChar)));
+}
+
+void QtnMemoryUsage::addString(const QByteArray &str)
+{
+	if (str.isNull())
+		return;
+
+	addShared(Strings, str.constData(),
+		qint64(sizeof(QArrayData)) + qint64(str.capacity() + 1));
+}
+
+void QtnMemoryUsage::addDelegateInfo(const QtnPropertyDelegateInfo &info)
+{
+	// map node holds key, value and links
+	qint64 bytes = qint64(sizeof(QtnPropertyDelegateInfo)) +
+		qint64(info.attributes.size()) *
+			qint64(sizeof(QByteArray) + sizeof(QVariant) + 3 * sizeof(void *));
+
+	// interned info is shared by properties
+	if (info.isInterned())
+	{
+		if (!addShared(DelegateInfos, &info, bytes))
+			return;
+	} else
+	{
+		add(DelegateInfos, bytes);
+	}
+
+	addString(info.name);
+	for (auto it = info.attributes.cbegin(); it != info.attributes.cend();
+		 ++it)
+	{
+		addString(it.key());
+	}
+}
+
+QtnMemoryUsage &QtnMemoryUsage::operator+=(const QtnMemoryUsage &other)
+{
+	for (int i = 0; i < CategoryCount; ++i)
+	{
+		m_categories[i].bytes += other.m_categories[i].bytes;
+		m_categories[i].count += other.m_categories[i].count;
+	}
+
+	for (auto it = other.m_propertyClasses.cbegin();
+		 it != other.m_propertyClasses.cend(); ++it)
+	{
+		auto &counter = m_propertyClasses[it.key()];
+		counter.bytes += it.value().bytes;
+		counter.count += it.value().count;
+	}
+
+	m_sharedData.unite(other.m_sharedData);
+	return *this;
+}
+
+QString QtnMemoryUsage::toString() const
+{
+	QString result;
+	QTextStream s(&result);
+
+	s << "Total: " << totalBytes() << " bytes\n";
+	for (int i = 0; i < CategoryCount; ++i)
+	{
+		auto &counter = m_categories[i];
+		s << categoryName(Category(i)) << ": " << counter.bytes
+		  << " bytes, " << counter.count << " objects\n";
+	}
+
+	if (!m_propertyClasses.isEmpty())
+	{
+		s << "Properties by class:\n";
+		for (auto it = m_propertyClasses.cbegin();
+			 it != m_propertyClasses.cend(); ++it)
+		{
+			s << "  " << it.key() << ": " << it.value().bytes << " bytes, "
+			  << it.value().count << " objects\n";
+		}
+	}
+
+	s.flush();
+	return result;
+}
+
+QString QtnMemoryUsage::categoryName(Category category)
+{
+	switch (category)
+	{
+		case Properties:
+			return QStringLiteral("Properties");
+		case DelegateInfos:
+			return QStringLiteral("Delegate infos");
+		case Delegates:
+			return QStringLiteral("Delegates");
+		case ViewItems:
+			return QStringLiteral("View items");
+		case SubItems:
+			return QStringLiteral("Sub-items");
+		case Connections:
+			return QStringLiteral("Connections");
+		case Strings:
+			return QStringLiteral("Strings");
+		case CategoryCount:
+			break;
+	}
+
+	return QString();
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+
+#include <QByteArray>
+#include <QMap>
+#include <QSet>
+#include <QString>
+
+struct QtnPropertyDelegateInfo;
+
+// Approximate memory footprint of property trees and views.
+// Own members and heap blocks are counted, allocator overhead and
+// private data of Qt objects are not. Shared data is counted once.
+class QTN_IMPORT_EXPORT QtnMemoryUsage
+{
+public:
+	enum Category
+	{
+		Properties,
+		DelegateInfos,
+		Delegates,
+		ViewItems,
+		SubItems,
+		Connections,
+		Strings,
+		CategoryCount
+	};
+
+	struct Counter
+	{
+		qint64 bytes = 0;
+		qint64 count = 0;
+	};
+
+	using ClassCounters = QMap<QByteArray, Counter>;
+
+	inline const Counter &category(Category category) const;
+	// properties by class name
+	inline const ClassCounters &propertyClasses() const;
+	qint64 totalBytes() const;
+
+	void add(Category category, qint64 bytes, qint64 count = 1);
+	void addProperty(const char *className, qint64 bytes, qint64 count = 1);
+
+	// returns false if data was already counted
+	bool addShared(Category category, const void *data, qint64 bytes);
+	void addString(const QString &str);
+	void addString(const QByteArray &str);
+	void addDelegateInfo(const QtnPropertyDelegateInfo &info);
+
+	QtnMemoryUsage &operator+=(const QtnMemoryUsage &other);
+
+	// multiline report with totals by category and property class
+	QString toString() const;
+
+	static QString categoryName(Category category);
+
+private:
+	Counter m_categories[CategoryCount];
+	ClassCounters m_propertyClasses;
+	QSet<const void *> m_sharedData;
+};
+
+const QtnMemoryUsage::Counter &QtnMemoryUsage::category(
+	Category category) const
+{
+	return m_categories[category];
+}
+
+const QtnMemoryUsage::ClassCounters &QtnMemoryUsage::propertyClasses() const
+{
+	return m_propertyClasses;
+}
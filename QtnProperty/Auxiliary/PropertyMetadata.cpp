@@ -0,0 +1,136 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#include "PropertyMetadata.h"
+#include "PropertyMemoryUsage.h"
+
+#include <QMutex>
+#include <QSet>
+
+static QSharedDataPointer<QtnPropertyMetadataData> qtnEmptyMetadataData()
+{
+	static const QSharedDataPointer<QtnPropertyMetadataData> empty(
+		new QtnPropertyMetadataData);
+	return empty;
+}
+
+QtnPropertyMetadata::QtnPropertyMetadata()
+	: d(qtnEmptyMetadataData())
+{
+}
+
+QtnPropertyMetadata::QtnPropertyMetadata(const QString &displayName,
+	const QString &description, const QString &help, const QIcon &icon)
+	: d(new QtnPropertyMetadataData)
+{
+	d->displayName = displayName;
+	d->description = description;
+	d->help = help;
+	d->icon = icon;
+}
+
+void QtnPropertyMetadata::setDisplayName(const QString &displayName)
+{
+	if (d.constData()->displayName == displayName)
+		return;
+
+	d->displayName = displayName;
+}
+
+void QtnPropertyMetadata::setDescription(const QString &description)
+{
+	if (d.constData()->description == description)
+		return;
+
+	d->description = description;
+}
+
+void QtnPropertyMetadata::setHelp(const QString &help)
+{
+	if (d.constData()->help == help)
+		return;
+
+	d->help = help;
+}
+
+void QtnPropertyMetadata::setIcon(const QIcon &icon)
+{
+	if (d.constData()->icon.cacheKey() == icon.cacheKey())
+		return;
+
+	d->icon = icon;
+}
+
+void QtnPropertyMetadata::collectMemoryUsage(QtnMemoryUsage &usage) const
+{
+	if (!usage.addShared(QtnMemoryUsage::Strings, d.constData(),
+			sizeof(QtnPropertyMetadataData)))
+	{
+		return;
+	}
+
+	usage.addString(displayName());
+	usage.addString(description());
+	usage.addString(help());
+}
+
+QtnPropertyMetadata QtnPropertyMetadata::interned() const
+{
+	static QMutex mutex;
+	static QSet<QtnPropertyMetadata> pool;
+	static int purgeSize = 64;
+
+	QMutexLocker locker(&mutex);
+
+	auto it = pool.constFind(*this);
+	if (it != pool.constEnd())
+		return *it;
+
+	// drop blocks nobody refers to except the pool
+	if (pool.size() >= purgeSize)
+	{
+		for (auto it = pool.begin(); it != pool.end();)
+		{
+			if (it->d.constData()->ref.loadAcquire() == 1)
+				it = pool.erase(it);
+			else
+				++it;
+		}
+
+		purgeSize = qMax(64, pool.size() * 2);
+	}
+
+	pool.insert(*this);
+	return *this;
+}
+
+bool QtnPropertyMetadata::operator==(const QtnPropertyMetadata &other) const
+{
+	if (isSharedWith(other))
+		return true;
+
+	return displayName() == other.displayName() &&
+		description() == other.description() && help() == other.help() &&
+		icon().cacheKey() == other.icon().cacheKey();
+}
+
+uint qHash(const QtnPropertyMetadata &metadata, uint seed)
+{
+	seed = qHash(metadata.displayName(), seed);
+	seed = qHash(metadata.description(), seed);
+	seed = qHash(metadata.help(), seed);
+	return qHash(metadata.icon().cacheKey(), seed);
+}
@@ -0,0 +1,105 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+
+#include <QSharedData>
+#include <QString>
+#include <QIcon>
+#include <QMetaType>
+
+class QtnMemoryUsage;
+
+struct QtnPropertyMetadataData : public QSharedData
+{
+	QString displayName;
+	QString description;
+	QString help;
+	QIcon icon;
+};
+
+// Implicitly shared descriptive data of property.
+// Properties with the same metadata can share a single interned block,
+// any setter detaches it.
+class QTN_IMPORT_EXPORT QtnPropertyMetadata
+{
+public:
+	QtnPropertyMetadata();
+	explicit QtnPropertyMetadata(const QString &displayName,
+		const QString &description = QString(),
+		const QString &help = QString(), const QIcon &icon = QIcon());
+
+	inline const QString &displayName() const;
+	void setDisplayName(const QString &displayName);
+
+	inline const QString &description() const;
+	void setDescription(const QString &description);
+
+	inline const QString &help() const;
+	void setHelp(const QString &help);
+
+	inline const QIcon &icon() const;
+	void setIcon(const QIcon &icon);
+
+	inline bool isSharedWith(const QtnPropertyMetadata &other) const;
+
+	void collectMemoryUsage(QtnMemoryUsage &usage) const;
+
+	// returns equal metadata sharing the block with other interned ones
+	QtnPropertyMetadata interned() const;
+
+	bool operator==(const QtnPropertyMetadata &other) const;
+	inline bool operator!=(const QtnPropertyMetadata &other) const;
+
+private:
+	QSharedDataPointer<QtnPropertyMetadataData> d;
+};
+
+QTN_IMPORT_EXPORT uint qHash(const QtnPropertyMetadata &metadata, uint seed = 0);
+
+const QString &QtnPropertyMetadata::displayName() const
+{
+	return d->displayName;
+}
+
+const QString &QtnPropertyMetadata::description() const
+{
+	return d->description;
+}
+
+const QString &QtnPropertyMetadata::help() const
+{
+	return d->help;
+}
+
+const QIcon &QtnPropertyMetadata::icon() const
+{
+	return d->icon;
+}
+
+bool QtnPropertyMetadata::isSharedWith(const QtnPropertyMetadata &other) const
+{
+	return d.constData() == other.d.constData();
+}
+
+bool QtnPropertyMetadata::operator!=(const QtnPropertyMetadata &other) const
+{
+	return !operator==(other);
+}
+
+Q_DECLARE_METATYPE(QtnPropertyMetadata)
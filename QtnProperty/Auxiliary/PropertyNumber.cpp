@@ -0,0 +1,135 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#include "PropertyNumber.h"
+
+static QStringRef qtnNumberTrimmed(const QStringRef &str)
+{
+	int begin = 0;
+	int end = str.size();
+	while (begin < end && str.at(begin).isSpace())
+		++begin;
+	while (end > begin && str.at(end - 1).isSpace())
+		--end;
+
+	return str.mid(begin, end - begin);
+}
+
+static bool qtnParseDigits(
+	const QStringRef &str, int pos, quint64 max, quint64 &value)
+{
+	int size = str.size();
+	if (pos >= size)
+		return false;
+
+	quint64 result = 0;
+	for (; pos < size; ++pos)
+	{
+		ushort c = str.at(pos).unicode();
+		if (c < '0' || c > '9')
+			return false;
+
+		quint64 digit = c - '0';
+		if (result > (max - digit) / 10)
+			return false;
+
+		result = result * 10 + digit;
+	}
+
+	value = result;
+	return true;
+}
+
+void qtnAppendInt64(QString &str, qint64 value)
+{
+	char buffer[24];
+	char *end = buffer + sizeof(buffer);
+	char *begin = end;
+
+	quint64 absValue = value < 0 ? quint64(0) - quint64(value) : quint64(value);
+	do
+	{
+		*--begin = char('0' + absValue % 10);
+		absValue /= 10;
+	} while (absValue != 0);
+
+	if (value < 0)
+		*--begin = '-';
+
+	str.append(QLatin1String(begin, int(end - begin)));
+}
+
+void qtnAppendUInt64(QString &str, quint64 value)
+{
+	char buffer[24];
+	char *end = buffer + sizeof(buffer);
+	char *begin = end;
+
+	do
+	{
+		*--begin = char('0' + value % 10);
+		value /= 10;
+	} while (value != 0);
+
+	str.append(QLatin1String(begin, int(end - begin)));
+}
+
+void qtnAppendDouble(QString &str, double value, int precision)
+{
+	str.append(QString::number(value, 'g', precision));
+}
+
+bool qtnStrToInt64(const QStringRef &str, qint64 &value)
+{
+	auto s = qtnNumberTrimmed(str);
+	if (s.isEmpty())
+		return false;
+
+	bool negative = s.at(0) == QLatin1Char('-');
+	int pos = (negative || s.at(0) == QLatin1Char('+')) ? 1 : 0;
+
+	quint64 max = negative ? quint64(std::numeric_limits<qint64>::max()) + 1
+						   : quint64(std::numeric_limits<qint64>::max());
+
+	quint64 absValue = 0;
+	if (!qtnParseDigits(s, pos, max, absValue))
+		return false;
+
+	value = negative ? qint64(quint64(0) - absValue) : qint64(absValue);
+	return true;
+}
+
+bool qtnStrToUInt64(const QStringRef &str, quint64 &value)
+{
+	auto s = qtnNumberTrimmed(str);
+	if (s.isEmpty())
+		return false;
+
+	int pos = s.at(0) == QLatin1Char('+') ? 1 : 0;
+	return qtnParseDigits(
+		s, pos, std::numeric_limits<quint64>::max(), value);
+}
+
+bool qtnStrToDouble(const QStringRef &str, double &value)
+{
+	bool ok = false;
+	double result = str.toDouble(&ok);
+	if (!ok)
+		return false;
+
+	value = result;
+	return true;
+}
@@ -0,0 +1,140 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+
+#include <QString>
+#include <QStringRef>
+#include <QtNumeric>
+
+#include <limits>
+#include <type_traits>
+
+// Locale independent number conversions used by string conversion of
+// numeric properties. Output is the same as of QString::number.
+// Integers are converted without allocations,
+// floating-point values are converted by Qt.
+
+QTN_IMPORT_EXPORT void qtnAppendInt64(QString &str, qint64 value);
+QTN_IMPORT_EXPORT void qtnAppendUInt64(QString &str, quint64 value);
+// same as QString::number(value, 'g', precision)
+QTN_IMPORT_EXPORT void qtnAppendDouble(
+	QString &str, double value, int precision);
+
+// precision of QString::arg(double)
+enum
+{
+	QtnArgDoublePrecision = 6
+};
+
+// Leading and trailing spaces are ignored. Fails if number is out of range.
+QTN_IMPORT_EXPORT bool qtnStrToInt64(const QStringRef &str, qint64 &value);
+QTN_IMPORT_EXPORT bool qtnStrToUInt64(const QStringRef &str, quint64 &value);
+QTN_IMPORT_EXPORT bool qtnStrToDouble(const QStringRef &str, double &value);
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value &&
+	std::is_signed<T>::value>::type
+qtnAppendNumber(QString &str, T value)
+{
+	qtnAppendInt64(str, qint64(value));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value &&
+	std::is_unsigned<T>::value>::type
+qtnAppendNumber(QString &str, T value)
+{
+	qtnAppendUInt64(str, quint64(value));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value>::type
+qtnAppendNumber(QString &str, T value,
+	int precision = std::numeric_limits<T>::digits10)
+{
+	qtnAppendDouble(str, double(value), precision);
+}
+
+template <typename T>
+inline QString qtnNumberToStr(T value)
+{
+	QString str;
+	qtnAppendNumber(str, value);
+	return str;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value &&
+		std::is_signed<T>::value,
+	bool>::type
+qtnStrToNumber(const QStringRef &str, T &value)
+{
+	qint64 result = 0;
+	if (!qtnStrToInt64(str, result) ||
+		result < qint64(std::numeric_limits<T>::min()) ||
+		result > qint64(std::numeric_limits<T>::max()))
+	{
+		return false;
+	}
+
+	value = T(result);
+	return true;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value &&
+		std::is_unsigned<T>::value,
+	bool>::type
+qtnStrToNumber(const QStringRef &str, T &value)
+{
+	quint64 result = 0;
+	if (!qtnStrToUInt64(str, result) ||
+		result > quint64(std::numeric_limits<T>::max()))
+	{
+		return false;
+	}
+
+	value = T(result);
+	return true;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+qtnStrToNumber(const QStringRef &str, T &value)
+{
+	double result = 0.0;
+	if (!qtnStrToDouble(str, result))
+		return false;
+
+	// same as QString::toFloat
+	if (qIsFinite(result) &&
+		qAbs(result) > double(std::numeric_limits<T>::max()))
+	{
+		return false;
+	}
+
+	value = T(result);
+	return true;
+}
+
+template <typename T>
+inline bool qtnStrToNumber(const QString &str, T &value)
+{
+	return qtnStrToNumber(QStringRef(&str), value);
+}
@@ -0,0 +1,135 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#include "PropertyStrParser.h"
+
+#include <cstring>
+
+QtnStrParser::QtnStrParser(const QStringRef &str)
+	: m_str(str)
+	, m_pos(0)
+	, m_errorPos(-1)
+{
+}
+
+QtnStrParser::QtnStrParser(const QString &str)
+	: QtnStrParser(QStringRef(&str))
+{
+}
+
+bool QtnStrParser::failed(int *errorPos) const
+{
+	if (errorPos)
+		*errorPos = m_errorPos;
+
+	return false;
+}
+
+void QtnStrParser::skipSpaces()
+{
+	int size = m_str.size();
+	while (m_pos < size && m_str.at(m_pos).isSpace())
+		m_pos++;
+}
+
+bool QtnStrParser::atEnd()
+{
+	skipSpaces();
+	return m_pos >= m_str.size();
+}
+
+bool QtnStrParser::readKeyword(QLatin1String keyword)
+{
+	skipSpaces();
+	int size = keyword.size();
+	if (m_str.size() - m_pos < size ||
+		m_str.mid(m_pos, size).compare(keyword, Qt::CaseInsensitive) != 0)
+	{
+		return fail(m_pos);
+	}
+
+	m_pos += size;
+	return true;
+}
+
+bool QtnStrParser::readChar(QChar ch)
+{
+	skipSpaces();
+	if (m_pos >= m_str.size() || m_str.at(m_pos) != ch)
+		return fail(m_pos);
+
+	m_pos++;
+	return true;
+}
+
+bool QtnStrParser::readToken(QStringRef &token, QLatin1String delimiters)
+{
+	skipSpaces();
+	int start = m_pos;
+	int size = m_str.size();
+	const char *d = delimiters.data();
+	int dsize = delimiters.size();
+	while (m_pos < size)
+	{
+		auto ch = m_str.at(m_pos);
+		if (ch.unicode() < 128 && memchr(d, char(ch.unicode()), size_t(dsize)))
+			break;
+
+		m_pos++;
+	}
+
+	int end = m_pos;
+	while (end > start && m_str.at(end - 1).isSpace())
+		end--;
+
+	if (end == start)
+		return fail(start);
+
+	token = m_str.mid(start, end - start);
+	return true;
+}
+
+bool QtnStrParser::readEnd()
+{
+	if (!atEnd())
+		return fail(m_pos);
+
+	return true;
+}
+
+bool QtnStrParser::fail(int position)
+{
+	if (m_errorPos < 0)
+		m_errorPos = position;
+
+	return false;
+}
+
+QStringRef QtnStrParser::readNumberToken()
+{
+	int start = m_pos;
+	int size = m_str.size();
+	while (m_pos < size)
+	{
+		auto ch = m_str.at(m_pos);
+		if (ch.isSpace() || ch == QLatin1Char(',') || ch == QLatin1Char(')'))
+			break;
+
+		m_pos++;
+	}
+
+	return m_str.mid(start, m_pos - start);
+}
@@ -0,0 +1,119 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+#include "PropertyNumber.h"
+
+#include <QString>
+#include <QStringRef>
+#include <QLatin1String>
+
+// Hand-written tokenizer for string forms of composite property values,
+// like "QRect(1, 2, 3, 4)" or "ONE|TWO". Keeps no shared state, so parsers
+// can run concurrently from any thread. On failure errorPosition() is
+// the index in the parsed string where the unexpected input starts.
+class QTN_IMPORT_EXPORT QtnStrParser
+{
+	Q_DISABLE_COPY(QtnStrParser)
+
+public:
+	explicit QtnStrParser(const QStringRef &str);
+	explicit QtnStrParser(const QString &str);
+
+	inline int position() const;
+	inline bool hasError() const;
+	// -1 if there was no error
+	inline int errorPosition() const;
+	// stores error position to errorPos if it is not nullptr
+	bool failed(int *errorPos) const;
+
+	void skipSpaces();
+	// true when only spaces are left
+	bool atEnd();
+
+	// case insensitive
+	bool readKeyword(QLatin1String keyword);
+	bool readChar(QChar ch);
+	// Reads text up to one of delimiters or end, without surrounding spaces.
+	// Empty token is an error.
+	bool readToken(QStringRef &token, QLatin1String delimiters);
+	// Reads number up to space, comma, closing bracket or end.
+	template <typename T>
+	bool readNumber(T &value);
+	// fails if anything except spaces is left
+	bool readEnd();
+
+	// Reads "keyword(value1, value2, ...)" and nothing else.
+	template <typename T>
+	bool readTuple(QLatin1String keyword, T *values, int count);
+
+	// marks error at position and returns false
+	bool fail(int position);
+
+private:
+	QStringRef readNumberToken();
+
+	QStringRef m_str;
+	int m_pos;
+	int m_errorPos;
+};
+
+int QtnStrParser::position() const
+{
+	return m_pos;
+}
+
+bool QtnStrParser::hasError() const
+{
+	return m_errorPos >= 0;
+}
+
+int QtnStrParser::errorPosition() const
+{
+	return m_errorPos;
+}
+
+template <typename T>
+bool QtnStrParser::readNumber(T &value)
+{
+	skipSpaces();
+	int start = m_pos;
+	auto token = readNumberToken();
+	if (token.isEmpty() || !qtnStrToNumber(token, value))
+		return fail(start);
+
+	return true;
+}
+
+template <typename T>
+bool QtnStrParser::readTuple(QLatin1String keyword, T *values, int count)
+{
+	if (!readKeyword(keyword) || !readChar(QLatin1Char('(')))
+		return false;
+
+	for (int i = 0; i < count; i++)
+	{
+		if (i > 0 && !readChar(QLatin1Char(',')))
+			return false;
+
+		if (!readNumber(values[i]))
+			return false;
+	}
+
+	return readChar(QLatin1Char(')')) && readEnd();
+}
@@ -347,6 +347,13 @@ protected:
 		m_value = newValue;
 	}
 
+	void memoryUsageImpl(QtnMemoryUsage &usage) const override
+	{
+		QtnSinglePropertyType::memoryUsageImpl(usage);
+		usage.addProperty(this->metaObject()->className(),
+			sizeof(ValueTypeStore), 0);
+	}
+
 private:
 	ValueTypeStore m_value;
 
@@ -437,6 +444,15 @@ protected:
 		m_callbackValueSet(newValue, reason);
 	}
 
+	void memoryUsageImpl(QtnMemoryUsage &usage) const override
+	{
+		QtnSinglePropertyType::memoryUsageImpl(usage);
+		usage.addProperty(this->metaObject()->className(),
+			sizeof(CallbackValueGet) * 2 + sizeof(CallbackValueSet) +
+				sizeof(CallbackValueAccepted) + sizeof(CallbackValueEqual),
+			0);
+	}
+
 	virtual bool isValueAcceptedImpl(ValueType valueToAccept) override
 	{
 		if (m_callbackValueAccepted)
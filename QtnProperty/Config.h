@@ -32,5 +32,9 @@ limitations under the License.
 #endif
 #endif
 
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+#define QTN_CBOR_SUPPORT
+#endif
+
 #define PERCENT_SUFFIX 1
 #define DEGREE_SUFFIX 2
@@ -16,6 +16,7 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyBool.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
 
 #include <QCoreApplication>
 
@@ -62,6 +63,24 @@ bool QtnPropertyBoolBase::toStrImpl(QString &str) const
 	return true;
 }
 
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyBoolBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	bool value = false;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
+
+	return setValue(value, reason);
+}
+
+bool QtnPropertyBoolBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(value());
+	return true;
+}
+#endif
+
 QtnPropertyBool::QtnPropertyBool(QObject *parent)
 	: QtnSinglePropertyValue<QtnPropertyBoolBase>(parent)
 {
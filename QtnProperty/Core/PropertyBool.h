@@ -36,6 +36,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS(QtnPropertyBoolBase)
 };
 
@@ -16,6 +16,8 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyDouble.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
 
 QtnPropertyDoubleBase::QtnPropertyDoubleBase(QObject *parent)
 	: QtnNumericPropertyBase<QtnSinglePropertyBase<double>>(parent)
@@ -25,10 +27,8 @@ QtnPropertyDoubleBase::QtnPropertyDoubleBase(QObject *parent)
 bool QtnPropertyDoubleBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	bool ok = false;
-	ValueType value = str.toDouble(&ok);
-
-	if (!ok)
+	ValueType value = 0;
+	if (!qtnStrToNumber(str, value))
 		return false;
 
 	return setValue(value, reason);
@@ -36,9 +36,27 @@ bool QtnPropertyDoubleBase::fromStrImpl(
 
 bool QtnPropertyDoubleBase::toStrImpl(QString &str) const
 {
-	str = QString::number(value(), 'g', std::numeric_limits<double>::digits10);
+	str = qtnNumberToStr(value());
+	return true;
+}
+
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyDoubleBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	double value = 0;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
+
+	return setValue(value, reason);
+}
+
+bool QtnPropertyDoubleBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(value());
 	return true;
 }
+#endif
 
 QtnPropertyDoubleCallback::QtnPropertyDoubleCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyDoubleBase>(parent)
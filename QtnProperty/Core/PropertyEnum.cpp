@@ -16,6 +16,7 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyEnum.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
 
 QtnPropertyEnumBase::QtnPropertyEnumBase(QObject *parent)
 	: QtnSinglePropertyBase<QtnEnumValueType>(parent)
@@ -49,6 +50,28 @@ bool QtnPropertyEnumBase::toStrImpl(QString &str) const
 	return m_enumInfo->toStr(str, enumValue);
 }
 
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyEnumBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	qint64 value = 0;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
+
+	if (value < std::numeric_limits<ValueType>::min() ||
+		value > std::numeric_limits<ValueType>::max())
+		return false;
+
+	return setValue(ValueType(value), reason);
+}
+
+bool QtnPropertyEnumBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(qint64(value()));
+	return true;
+}
+#endif
+
 bool QtnPropertyEnumBase::isValueAcceptedImpl(ValueType valueToAccept)
 {
 	if (!m_enumInfo)
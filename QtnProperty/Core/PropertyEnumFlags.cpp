@@ -16,6 +16,8 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyEnumFlags.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
 
 QtnPropertyEnumFlagsBase::QtnPropertyEnumFlagsBase(QObject *parent)
 	: QtnSinglePropertyBase<QtnEnumFlagsValueType>(parent)
@@ -30,39 +32,8 @@ bool QtnPropertyEnumFlagsBase::fromStrImpl(
 		return false;
 
 	QtnEnumFlagsValueType val = 0;
-	QString enumStr = str.trimmed();
-
-	if (!enumStr.isEmpty() && enumStr != "0")
-	{
-		static QRegExp parserEnumFlags(
-			QStringLiteral("^\\s*([^|\\s]+)\\s*\\|(.+)$"), Qt::CaseInsensitive);
-
-		while (parserEnumFlags.exactMatch(enumStr))
-		{
-			QStringList params = parserEnumFlags.capturedTexts();
-
-			if (params.size() != 3)
-				return false;
-
-			const QtnEnumValueInfo *enumValue = m_enumInfo->fromStr(params[1]);
-
-			if (!enumValue)
-				return false;
-
-			val = val | enumValue->value();
-
-			enumStr = params[2];
-		}
-
-		const QtnEnumValueInfo *enumValue = m_enumInfo->fromStr(enumStr);
-
-		if (!enumValue)
-			return false;
-
-		val = val | enumValue->value();
-	}
-
-	return setValue(val, reason);
+	return QtnPropertyEnumFlags::flagsFromStr(*m_enumInfo, str, val) &&
+		setValue(val, reason);
 }
 
 bool QtnPropertyEnumFlagsBase::toStrImpl(QString &str) const
@@ -78,28 +49,32 @@ bool QtnPropertyEnumFlagsBase::toStrImpl(QString &str) const
 		return true;
 	}
 
-	QString strValues;
-	m_enumInfo->forEachEnumValue(
-		[&strValues, v, this](const QtnEnumValueInfo &value) -> bool //
-		{
-			if (v & value.value())
-			{
-				if (!strValues.isEmpty())
-					strValues += "|";
+	str = m_enumInfo->flagsToStr(v);
+	Q_ASSERT(!str.isEmpty());
+	return true;
+}
 
-				QString enumStr;
-				m_enumInfo->toStr(enumStr, &value);
-				strValues += enumStr;
-			}
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyEnumFlagsBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	qint64 value = 0;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
 
-			return true;
-		});
+	if (value < std::numeric_limits<ValueType>::min() ||
+		value > std::numeric_limits<ValueType>::max())
+		return false;
 
-	Q_ASSERT(!strValues.isEmpty());
+	return setValue(ValueType(value), reason);
+}
 
-	str = strValues;
+bool QtnPropertyEnumFlagsBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(qint64(value()));
 	return true;
 }
+#endif
 
 QtnPropertyEnumFlags::QtnPropertyEnumFlags(QObject *parent)
 	: QtnSinglePropertyValue<QtnPropertyEnumFlagsBase>(parent)
@@ -112,7 +87,55 @@ QString QtnPropertyEnumFlags::getFlagLabelDescription(
 	return tr("%1 flag for %2").arg(flagName, ownerName);
 }
 
+QString QtnPropertyEnumFlags::getFlagsSummary(
+	const QString &firstFlags, int flagCount, int totalFlagCount)
+{
+	return tr("%1|... (%2 of %3)")
+		.arg(firstFlags)
+		.arg(flagCount)
+		.arg(totalFlagCount);
+}
+
 QtnPropertyEnumFlagsCallback::QtnPropertyEnumFlagsCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyEnumFlagsBase>(parent)
 {
 }
+
+bool QtnPropertyEnumFlags::flagsFromStr(const QtnEnumInfo &enumInfo,
+	const QString &str, QtnEnumFlagsValueType &value, int *errorPos)
+{
+	QtnStrParser parser(str);
+	if (parser.atEnd() || str.trimmed() == QLatin1String("0"))
+	{
+		value = 0;
+		return true;
+	}
+
+	QtnEnumFlagsValueType result = 0;
+	forever
+	{
+		parser.skipSpaces();
+		int position = parser.position();
+		QStringRef token;
+		if (!parser.readToken(token, QLatin1String("|")))
+			return parser.failed(errorPos);
+
+		auto enumValue = enumInfo.fromStr(token.toString());
+		if (!enumValue)
+		{
+			parser.fail(position);
+			return parser.failed(errorPos);
+		}
+
+		result |= enumValue->value();
+
+		if (parser.atEnd())
+			break;
+
+		if (!parser.readChar(QLatin1Char('|')))
+			return parser.failed(errorPos);
+	}
+
+	value = result;
+	return true;
+}
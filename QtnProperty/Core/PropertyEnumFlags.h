@@ -45,6 +45,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 private:
 	const QtnEnumInfo *m_enumInfo;
 
@@ -93,6 +100,12 @@ public:
 
 	static QString getFlagLabelDescription(
 		const QString &flagName, const QString &ownerName);
+	static QString getFlagsSummary(
+		const QString &firstFlags, int flagCount, int totalFlagCount);
+	// Parses "0" or flag names separated by '|'.
+	// errorPos receives the index of unexpected input on failure
+	static bool flagsFromStr(const QtnEnumInfo &enumInfo, const QString &str,
+		QtnEnumFlagsValueType &value, int *errorPos = nullptr);
 
 	P_PROPERTY_DECL_MEMBER_OPERATORS2(
 		QtnPropertyEnumFlags, QtnPropertyEnumFlagsBase)
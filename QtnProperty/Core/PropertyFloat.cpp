@@ -16,6 +16,8 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyFloat.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
 
 QtnPropertyFloatBase::QtnPropertyFloatBase(QObject *parent)
 	: QtnNumericPropertyBase<QtnSinglePropertyBase<float>>(parent)
@@ -25,10 +27,8 @@ QtnPropertyFloatBase::QtnPropertyFloatBase(QObject *parent)
 bool QtnPropertyFloatBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	bool ok = false;
-	ValueType value = str.toFloat(&ok);
-
-	if (!ok)
+	ValueType value = 0;
+	if (!qtnStrToNumber(str, value))
 		return false;
 
 	return setValue(value, reason);
@@ -36,9 +36,27 @@ bool QtnPropertyFloatBase::fromStrImpl(
 
 bool QtnPropertyFloatBase::toStrImpl(QString &str) const
 {
-	str = QString::number(value(), 'g', std::numeric_limits<float>::digits10);
+	str = qtnNumberToStr(value());
+	return true;
+}
+
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyFloatBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	double value = 0;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
+
+	return setValue(ValueType(value), reason);
+}
+
+bool QtnPropertyFloatBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(value());
 	return true;
 }
+#endif
 
 QtnPropertyFloatCallback::QtnPropertyFloatCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyFloatBase>(parent)
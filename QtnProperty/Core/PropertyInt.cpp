@@ -16,6 +16,8 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyInt.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
 
 #include <QLocale>
 
@@ -27,10 +29,8 @@ QtnPropertyIntBase::QtnPropertyIntBase(QObject *parent)
 bool QtnPropertyIntBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	bool ok = false;
-	ValueType value = str.toInt(&ok);
-
-	if (!ok)
+	ValueType value = 0;
+	if (!qtnStrToNumber(str, value))
 		return false;
 
 	return setValue(value, reason);
@@ -38,9 +38,31 @@ bool QtnPropertyIntBase::fromStrImpl(
 
 bool QtnPropertyIntBase::toStrImpl(QString &str) const
 {
-	str = QString::number(value());
+	str = qtnNumberToStr(value());
+	return true;
+}
+
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyIntBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	qint64 value = 0;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
+
+	if (value < std::numeric_limits<ValueType>::min() ||
+		value > std::numeric_limits<ValueType>::max())
+		return false;
+
+	return setValue(ValueType(value), reason);
+}
+
+bool QtnPropertyIntBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(qint64(value()));
 	return true;
 }
+#endif
 
 QtnPropertyIntCallback::QtnPropertyIntCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyIntBase>(parent)
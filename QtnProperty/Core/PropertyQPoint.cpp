@@ -16,6 +16,9 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyQPoint.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
 
 QtnPropertyQPointBase::QtnPropertyQPointBase(QObject *parent)
 	: ParentClass(parent)
@@ -39,48 +42,44 @@ QtnProperty *QtnPropertyQPointBase::createYProperty()
 bool QtnPropertyQPointBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	static QRegExp parserPoint(
-		"^\\s*QPoint\\s*\\(([^\\)]+)\\)\\s*$", Qt::CaseInsensitive);
-
-	if (!parserPoint.exactMatch(str))
-		return false;
-
-	QStringList params = parserPoint.capturedTexts();
-
-	if (params.size() != 2)
-		return false;
-
-	static QRegExp parserParams(
-		"^\\s*(-?\\d+)\\s*,\\s*(-?\\d+)\\s*$", Qt::CaseInsensitive);
-
-	if (!parserParams.exactMatch(params[1]))
-		return false;
-
-	params = parserParams.capturedTexts();
-
-	if (params.size() != 3)
-		return false;
-
-	bool ok = false;
-	int x = params[1].toInt(&ok);
+	QPoint point;
+	return QtnPropertyQPoint::pointFromStr(str, point) &&
+		setValue(point, reason);
+}
 
-	if (!ok)
-		return false;
+bool QtnPropertyQPointBase::toStrImpl(QString &str) const
+{
+	QPoint v = value();
+	str = QStringLiteral("QPoint(");
+	qtnAppendNumber(str, v.x());
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.y());
+	str += QLatin1Char(')');
+	return true;
+}
 
-	int y = params[2].toInt(&ok);
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyQPointBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	if (!reader.isArray())
+		return QtnProperty::fromCborImpl(reader, reason);
 
-	if (!ok)
+	int v[2];
+	if (!qtnCborReadArray(reader, v, 2))
 		return false;
 
-	return setValue(QPoint(x, y), reason);
+	return setValue(QPoint(v[0], v[1]), reason);
 }
 
-bool QtnPropertyQPointBase::toStrImpl(QString &str) const
+bool QtnPropertyQPointBase::toCborImpl(QCborStreamWriter &writer) const
 {
-	QPoint v = value();
-	str = QStringLiteral("QPoint(%1, %2)").arg(v.x()).arg(v.y());
+	auto value = this->value();
+	int v[2] = { value.x(), value.y() };
+	qtnCborWriteArray(writer, v, 2);
 	return true;
 }
+#endif
 
 QtnPropertyQPoint::QtnPropertyQPoint(QObject *parent)
 	: QtnSinglePropertyValue<QtnPropertyQPointBase>(parent)
@@ -126,3 +125,15 @@ QtnPropertyQPointCallback::QtnPropertyQPointCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyQPointBase>(parent)
 {
 }
+
+bool QtnPropertyQPoint::pointFromStr(
+	const QString &str, QPoint &point, int *errorPos)
+{
+	int v[2];
+	QtnStrParser parser(str);
+	if (!parser.readTuple(QLatin1String("QPoint"), v, 2))
+		return parser.failed(errorPos);
+
+	point = QPoint(v[0], v[1]);
+	return true;
+}
@@ -43,6 +43,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS(QtnPropertyQPointBase)
 };
 
@@ -77,6 +84,10 @@ public:
 
 	static QString getToStringFormat();
 
+	// errorPos receives the index of unexpected input on failure
+	static bool pointFromStr(
+		const QString &str, QPoint &point, int *errorPos = nullptr);
+
 	static QString xKey();
 	static QString xDisplayName();
 	static QString xDescriptionFmt();
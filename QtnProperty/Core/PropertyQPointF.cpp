@@ -18,6 +18,9 @@ limitations under the License.
 #include "PropertyQPointF.h"
 
 #include "PropertyQPoint.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
 
 QtnPropertyQPointFBase::QtnPropertyQPointFBase(QObject *parent)
 	: ParentClass(parent)
@@ -59,50 +62,44 @@ QString QtnPropertyQPointFBase::getYDescriptionFormat() const
 bool QtnPropertyQPointFBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	static QRegExp parserPoint(
-		QLatin1String("^\\s*QPointF\\s*\\(([^\\)]+)\\)\\s*$"),
-		Qt::CaseInsensitive);
-
-	if (!parserPoint.exactMatch(str))
-		return false;
-
-	QStringList params = parserPoint.capturedTexts();
-
-	if (params.size() != 2)
-		return false;
-
-	static QRegExp parserParams(
-		"^\\s*(\\-?\\d+(\\.\\d{0,})?)\\s*,\\s*(\\-?\\d+(\\.\\d{0,})?)\\s*$",
-		Qt::CaseInsensitive);
-
-	if (!parserParams.exactMatch(params[1]))
-		return false;
-
-	params = parserParams.capturedTexts();
-
-	if (params.size() != 5)
-		return false;
-
-	bool ok = false;
-	double x = params[1].toDouble(&ok);
+	QPointF point;
+	return QtnPropertyQPointF::pointFromStr(str, point) &&
+		setValue(point, reason);
+}
 
-	if (!ok)
-		return false;
+bool QtnPropertyQPointFBase::toStrImpl(QString &str) const
+{
+	QPointF v = value();
+	str = QStringLiteral("QPointF(");
+	qtnAppendNumber(str, v.x(), QtnArgDoublePrecision);
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.y(), QtnArgDoublePrecision);
+	str += QLatin1Char(')');
+	return true;
+}
 
-	double y = params[3].toDouble(&ok);
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyQPointFBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	if (!reader.isArray())
+		return QtnProperty::fromCborImpl(reader, reason);
 
-	if (!ok)
+	qreal v[2];
+	if (!qtnCborReadArray(reader, v, 2))
 		return false;
 
-	return setValue(QPointF(x, y), reason);
+	return setValue(QPointF(v[0], v[1]), reason);
 }
 
-bool QtnPropertyQPointFBase::toStrImpl(QString &str) const
+bool QtnPropertyQPointFBase::toCborImpl(QCborStreamWriter &writer) const
 {
-	QPointF v = value();
-	str = QStringLiteral("QPointF(%1, %2)").arg(v.x()).arg(v.y());
+	auto value = this->value();
+	qreal v[2] = { value.x(), value.y() };
+	qtnCborWriteArray(writer, v, 2);
 	return true;
 }
+#endif
 
 QtnPropertyQPointF::QtnPropertyQPointF(QObject *parent)
 	: QtnSinglePropertyValue<QtnPropertyQPointFBase>(parent)
@@ -113,3 +110,15 @@ QtnPropertyQPointFCallback::QtnPropertyQPointFCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyQPointFBase>(parent)
 {
 }
+
+bool QtnPropertyQPointF::pointFromStr(
+	const QString &str, QPointF &point, int *errorPos)
+{
+	qreal v[2];
+	QtnStrParser parser(str);
+	if (!parser.readTuple(QLatin1String("QPointF"), v, 2))
+		return parser.failed(errorPos);
+
+	point = QPointF(v[0], v[1]);
+	return true;
+}
@@ -49,6 +49,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS(QtnPropertyQPointFBase)
 };
 
@@ -81,6 +88,10 @@ private:
 public:
 	Q_INVOKABLE explicit QtnPropertyQPointF(QObject *parent = nullptr);
 
+	// errorPos receives the index of unexpected input on failure
+	static bool pointFromStr(
+		const QString &str, QPointF &point, int *errorPos = nullptr);
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS2(
 		QtnPropertyQPointF, QtnPropertyQPointFBase)
 };
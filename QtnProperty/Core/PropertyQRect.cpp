@@ -18,6 +18,9 @@ limitations under the License.
 #include "PropertyQRect.h"
 
 #include "PropertyQSize.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
 
 QtnProperty *QtnPropertyQRectBase::createLeftProperty(bool move)
 {
@@ -82,58 +85,49 @@ QtnPropertyQRectBase::QtnPropertyQRectBase(QObject *parent)
 bool QtnPropertyQRectBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	static QRegExp parserRect(
-		"^\\s*QRect\\s*\\(([^\\)]+)\\)\\s*$", Qt::CaseInsensitive);
-	static QRegExp parserParams(
-		"^\\s*(-?\\d+)\\s*,\\s*(-?\\d+)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)\\s*$",
-		Qt::CaseInsensitive);
-
-	if (!parserRect.exactMatch(str))
-		return false;
-
-	QStringList params = parserRect.capturedTexts();
-	if (params.size() != 2)
-		return false;
-
-	if (!parserParams.exactMatch(params[1]))
-		return false;
+	QRect rect;
+	return QtnPropertyQRect::rectFromStr(str, rect) && setValue(rect, reason);
+}
 
-	params = parserParams.capturedTexts();
-	if (params.size() != 5)
-		return false;
+bool QtnPropertyQRectBase::toStrImpl(QString &str) const
+{
+	auto v = value();
 
-	bool ok = false;
-	int left = params[1].toInt(&ok);
-	if (!ok)
-		return false;
+	str = QStringLiteral("QRect(");
+	qtnAppendNumber(str, v.left());
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.top());
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.width());
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.height());
+	str += QLatin1Char(')');
 
-	int top = params[2].toInt(&ok);
-	if (!ok)
-		return false;
+	return true;
+}
 
-	int width = params[3].toInt(&ok);
-	if (!ok)
-		return false;
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyQRectBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	if (!reader.isArray())
+		return QtnProperty::fromCborImpl(reader, reason);
 
-	int height = params[4].toInt(&ok);
-	if (!ok)
+	int v[4];
+	if (!qtnCborReadArray(reader, v, 4))
 		return false;
 
-	return setValue(QRect(left, top, width, height), reason);
+	return setValue(QRect(v[0], v[1], v[2], v[3]), reason);
 }
 
-bool QtnPropertyQRectBase::toStrImpl(QString &str) const
+bool QtnPropertyQRectBase::toCborImpl(QCborStreamWriter &writer) const
 {
-	auto v = value();
-
-	str = QStringLiteral("QRect(%1, %2, %3, %4)")
-			  .arg(v.left())
-			  .arg(v.top())
-			  .arg(v.width())
-			  .arg(v.height());
-
+	auto value = this->value();
+	int v[4] = { value.left(), value.top(), value.width(), value.height() };
+	qtnCborWriteArray(writer, v, 4);
 	return true;
 }
+#endif
 
 QtnPropertyQRect::QtnPropertyQRect(QObject *parent)
 	: QtnSinglePropertyValue<QtnPropertyQRectBase>(parent)
@@ -209,3 +203,39 @@ QtnPropertyQRectCallback::QtnPropertyQRectCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyQRectBase>(parent)
 {
 }
+
+bool QtnPropertyQRect::rectFromStr(
+	const QString &str, QRect &rect, int *errorPos)
+{
+	int v[4];
+	QtnStrParser parser(str);
+	if (!parser.readKeyword(QLatin1String("QRect")) ||
+		!parser.readChar(QLatin1Char('(')))
+	{
+		return parser.failed(errorPos);
+	}
+
+	for (int i = 0; i < 4; i++)
+	{
+		if (i > 0 && !parser.readChar(QLatin1Char(',')))
+			return parser.failed(errorPos);
+
+		parser.skipSpaces();
+		int position = parser.position();
+		if (!parser.readNumber(v[i]))
+			return parser.failed(errorPos);
+
+		// width and height cannot be negative
+		if (i >= 2 && v[i] < 0)
+		{
+			parser.fail(position);
+			return parser.failed(errorPos);
+		}
+	}
+
+	if (!parser.readChar(QLatin1Char(')')) || !parser.readEnd())
+		return parser.failed(errorPos);
+
+	rect = QRect(v[0], v[1], v[2], v[3]);
+	return true;
+}
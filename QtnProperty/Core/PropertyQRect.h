@@ -47,6 +47,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS(QtnPropertyQRectBase)
 };
 
@@ -82,6 +89,9 @@ public:
 	static QByteArray delegateName(bool coordinateMode);
 
 	static QString getToStringFormat(bool m_coordinates);
+	// errorPos receives the index of unexpected input on failure
+	static bool rectFromStr(
+		const QString &str, QRect &rect, int *errorPos = nullptr);
 	static QString leftKey();
 	static QString leftString();
 	static QString leftDescriptionFmt();
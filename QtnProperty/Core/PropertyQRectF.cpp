@@ -19,6 +19,9 @@ limitations under the License.
 
 #include "PropertyQRect.h"
 #include "PropertyQSize.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
 
 QtnProperty *QtnPropertyQRectFBase::createLeftProperty(bool move)
 {
@@ -73,59 +76,49 @@ QtnPropertyQRectFBase::QtnPropertyQRectFBase(QObject *parent)
 bool QtnPropertyQRectFBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	static QRegExp parserRect(
-		"^\\s*QRectF\\s*\\(([^\\)]+)\\)\\s*$", Qt::CaseInsensitive);
-	static QRegExp parserParams("^\\s*(\\-?\\d+(\\.\\d{0,})?)\\s*,\\s*(\\-?\\d+"
-								"(\\.\\d{0,})?)\\s*,\\s*(\\d+(\\.\\d{0,})?)\\s*"
-								",\\s*(\\d+(\\.\\d{0,})?)\\s*$",
-		Qt::CaseInsensitive);
-
-	if (!parserRect.exactMatch(str))
-		return false;
-
-	QStringList params = parserRect.capturedTexts();
-	if (params.size() != 2)
-		return false;
-
-	if (!parserParams.exactMatch(params[1]))
-		return false;
+	QRectF rect;
+	return QtnPropertyQRectF::rectFromStr(str, rect) && setValue(rect, reason);
+}
 
-	params = parserParams.capturedTexts();
-	if (params.size() != 9)
-		return false;
+bool QtnPropertyQRectFBase::toStrImpl(QString &str) const
+{
+	auto v = value();
 
-	bool ok = false;
-	double left = params[1].toDouble(&ok);
-	if (!ok)
-		return false;
+	str = QStringLiteral("QRectF(");
+	qtnAppendNumber(str, v.left(), QtnArgDoublePrecision);
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.top(), QtnArgDoublePrecision);
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.width(), QtnArgDoublePrecision);
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.height(), QtnArgDoublePrecision);
+	str += QLatin1Char(')');
 
-	double top = params[3].toDouble(&ok);
-	if (!ok)
-		return false;
+	return true;
+}
 
-	double width = params[5].toDouble(&ok);
-	if (!ok)
-		return false;
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyQRectFBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	if (!reader.isArray())
+		return QtnProperty::fromCborImpl(reader, reason);
 
-	double height = params[7].toDouble(&ok);
-	if (!ok)
+	qreal v[4];
+	if (!qtnCborReadArray(reader, v, 4))
 		return false;
 
-	return setValue(QRectF(left, top, width, height), reason);
+	return setValue(QRectF(v[0], v[1], v[2], v[3]), reason);
 }
 
-bool QtnPropertyQRectFBase::toStrImpl(QString &str) const
+bool QtnPropertyQRectFBase::toCborImpl(QCborStreamWriter &writer) const
 {
-	auto v = value();
-
-	str = QStringLiteral("QRectF(%1, %2, %3, %4)")
-			  .arg(v.left())
-			  .arg(v.top())
-			  .arg(v.width())
-			  .arg(v.height());
-
+	auto value = this->value();
+	qreal v[4] = { value.left(), value.top(), value.width(), value.height() };
+	qtnCborWriteArray(writer, v, 4);
 	return true;
 }
+#endif
 
 QtnPropertyQRectF::QtnPropertyQRectF(QObject *parent)
 	: QtnSinglePropertyValue<QtnPropertyQRectFBase>(parent)
@@ -136,3 +129,39 @@ QtnPropertyQRectFCallback::QtnPropertyQRectFCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyQRectFBase>(parent)
 {
 }
+
+bool QtnPropertyQRectF::rectFromStr(
+	const QString &str, QRectF &rect, int *errorPos)
+{
+	qreal v[4];
+	QtnStrParser parser(str);
+	if (!parser.readKeyword(QLatin1String("QRectF")) ||
+		!parser.readChar(QLatin1Char('(')))
+	{
+		return parser.failed(errorPos);
+	}
+
+	for (int i = 0; i < 4; i++)
+	{
+		if (i > 0 && !parser.readChar(QLatin1Char(',')))
+			return parser.failed(errorPos);
+
+		parser.skipSpaces();
+		int position = parser.position();
+		if (!parser.readNumber(v[i]))
+			return parser.failed(errorPos);
+
+		// width and height cannot be negative
+		if (i >= 2 && v[i] < 0)
+		{
+			parser.fail(position);
+			return parser.failed(errorPos);
+		}
+	}
+
+	if (!parser.readChar(QLatin1Char(')')) || !parser.readEnd())
+		return parser.failed(errorPos);
+
+	rect = QRectF(v[0], v[1], v[2], v[3]);
+	return true;
+}
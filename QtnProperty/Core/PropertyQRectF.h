@@ -47,6 +47,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS(QtnPropertyQRectFBase)
 };
 
@@ -79,6 +86,10 @@ private:
 public:
 	Q_INVOKABLE explicit QtnPropertyQRectF(QObject *parent = nullptr);
 
+	// errorPos receives the index of unexpected input on failure
+	static bool rectFromStr(
+		const QString &str, QRectF &rect, int *errorPos = nullptr);
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS2(QtnPropertyQRectF, QtnPropertyQRectFBase)
 };
 
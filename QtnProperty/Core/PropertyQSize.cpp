@@ -17,6 +17,9 @@ limitations under the License.
 
 #include "PropertyQSize.h"
 #include "PropertyInt.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
 
 QtnPropertyQSizeBase::QtnPropertyQSizeBase(QObject *parent)
 	: ParentClass(parent)
@@ -40,48 +43,43 @@ QtnProperty *QtnPropertyQSizeBase::createHeightProperty()
 bool QtnPropertyQSizeBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	static QRegExp parserSize(
-		"^\\s*QSize\\s*\\(([^\\)]+)\\)\\s*$", Qt::CaseInsensitive);
-
-	if (!parserSize.exactMatch(str))
-		return false;
-
-	QStringList params = parserSize.capturedTexts();
-
-	if (params.size() != 2)
-		return false;
-
-	static QRegExp parserParams(
-		"^\\s*(-?\\d+)\\s*,\\s*(-?\\d+)\\s*$", Qt::CaseInsensitive);
-
-	if (!parserParams.exactMatch(params[1]))
-		return false;
-
-	params = parserParams.capturedTexts();
-
-	if (params.size() != 3)
-		return false;
-
-	bool ok = false;
-	int width = params[1].toInt(&ok);
+	QSize size;
+	return QtnPropertyQSize::sizeFromStr(str, size) && setValue(size, reason);
+}
 
-	if (!ok)
-		return false;
+bool QtnPropertyQSizeBase::toStrImpl(QString &str) const
+{
+	QSize v = value();
+	str = QStringLiteral("QSize(");
+	qtnAppendNumber(str, v.width());
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.height());
+	str += QLatin1Char(')');
+	return true;
+}
 
-	int height = params[2].toInt(&ok);
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyQSizeBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	if (!reader.isArray())
+		return QtnProperty::fromCborImpl(reader, reason);
 
-	if (!ok)
+	int v[2];
+	if (!qtnCborReadArray(reader, v, 2))
 		return false;
 
-	return setValue(QSize(width, height), reason);
+	return setValue(QSize(v[0], v[1]), reason);
 }
 
-bool QtnPropertyQSizeBase::toStrImpl(QString &str) const
+bool QtnPropertyQSizeBase::toCborImpl(QCborStreamWriter &writer) const
 {
-	QSize v = value();
-	str = QString("QSize(%1, %2)").arg(v.width()).arg(v.height());
+	auto value = this->value();
+	int v[2] = { value.width(), value.height() };
+	qtnCborWriteArray(writer, v, 2);
 	return true;
 }
+#endif
 
 QtnPropertyQSize::QtnPropertyQSize(QObject *parent)
 	: QtnSinglePropertyValue<QtnPropertyQSizeBase>(parent)
@@ -127,3 +125,15 @@ QtnPropertyQSizeCallback::QtnPropertyQSizeCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyQSizeBase>(parent)
 {
 }
+
+bool QtnPropertyQSize::sizeFromStr(
+	const QString &str, QSize &size, int *errorPos)
+{
+	int v[2];
+	QtnStrParser parser(str);
+	if (!parser.readTuple(QLatin1String("QSize"), v, 2))
+		return parser.failed(errorPos);
+
+	size = QSize(v[0], v[1]);
+	return true;
+}
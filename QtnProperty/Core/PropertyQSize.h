@@ -43,6 +43,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS(QtnPropertyQSizeBase)
 };
 
@@ -76,6 +83,9 @@ public:
 	Q_INVOKABLE explicit QtnPropertyQSize(QObject *parent = nullptr);
 
 	static QString getToStringFormat();
+	// errorPos receives the index of unexpected input on failure
+	static bool sizeFromStr(
+		const QString &str, QSize &size, int *errorPos = nullptr);
 	static QString widthKey();
 	static QString widthDisplayName();
 	static QString widthDescriptionFmt();
@@ -18,6 +18,9 @@ limitations under the License.
 #include "PropertyQSizeF.h"
 
 #include "PropertyQSize.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
 
 QtnPropertyQSizeFBase::QtnPropertyQSizeFBase(QObject *parent)
 	: ParentClass(parent)
@@ -41,49 +44,43 @@ QtnProperty *QtnPropertyQSizeFBase::createHeightProperty()
 bool QtnPropertyQSizeFBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	static QRegExp parserSize(
-		"^\\s*QSizeF\\s*\\(([^\\)]+)\\)\\s*$", Qt::CaseInsensitive);
-
-	if (!parserSize.exactMatch(str))
-		return false;
-
-	QStringList params = parserSize.capturedTexts();
-
-	if (params.size() != 2)
-		return false;
-
-	static QRegExp parserParams(
-		"^\\s*(\\-?\\d+(\\.\\d{0,})?)\\s*,\\s*(\\-?\\d+(\\.\\d{0,})?)\\s*$",
-		Qt::CaseInsensitive);
-
-	if (!parserParams.exactMatch(params[1]))
-		return false;
-
-	params = parserParams.capturedTexts();
-
-	if (params.size() != 5)
-		return false;
-
-	bool ok = false;
-	double width = params[1].toDouble(&ok);
+	QSizeF size;
+	return QtnPropertyQSizeF::sizeFromStr(str, size) && setValue(size, reason);
+}
 
-	if (!ok)
-		return false;
+bool QtnPropertyQSizeFBase::toStrImpl(QString &str) const
+{
+	QSizeF v = value();
+	str = QStringLiteral("QSizeF(");
+	qtnAppendNumber(str, v.width(), QtnArgDoublePrecision);
+	str += QStringLiteral(", ");
+	qtnAppendNumber(str, v.height(), QtnArgDoublePrecision);
+	str += QLatin1Char(')');
+	return true;
+}
 
-	double height = params[3].toDouble(&ok);
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyQSizeFBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	if (!reader.isArray())
+		return QtnProperty::fromCborImpl(reader, reason);
 
-	if (!ok)
+	qreal v[2];
+	if (!qtnCborReadArray(reader, v, 2))
 		return false;
 
-	return setValue(QSizeF(width, height), reason);
+	return setValue(QSizeF(v[0], v[1]), reason);
 }
 
-bool QtnPropertyQSizeFBase::toStrImpl(QString &str) const
+bool QtnPropertyQSizeFBase::toCborImpl(QCborStreamWriter &writer) const
 {
-	QSizeF v = value();
-	str = QString("QSizeF(%1, %2)").arg(v.width()).arg(v.height());
+	auto value = this->value();
+	qreal v[2] = { value.width(), value.height() };
+	qtnCborWriteArray(writer, v, 2);
 	return true;
 }
+#endif
 
 QtnPropertyQSizeF::QtnPropertyQSizeF(QObject *parent)
 	: QtnSinglePropertyValue<QtnPropertyQSizeFBase>(parent)
@@ -94,3 +91,15 @@ QtnPropertyQSizeFCallback::QtnPropertyQSizeFCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyQSizeFBase>(parent)
 {
 }
+
+bool QtnPropertyQSizeF::sizeFromStr(
+	const QString &str, QSizeF &size, int *errorPos)
+{
+	qreal v[2];
+	QtnStrParser parser(str);
+	if (!parser.readTuple(QLatin1String("QSizeF"), v, 2))
+		return parser.failed(errorPos);
+
+	size = QSizeF(v[0], v[1]);
+	return true;
+}
@@ -43,6 +43,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS(QtnPropertyQSizeFBase)
 };
 
@@ -75,6 +82,10 @@ private:
 public:
 	Q_INVOKABLE explicit QtnPropertyQSizeF(QObject *parent = nullptr);
 
+	// errorPos receives the index of unexpected input on failure
+	static bool sizeFromStr(
+		const QString &str, QSizeF &size, int *errorPos = nullptr);
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS2(QtnPropertyQSizeF, QtnPropertyQSizeFBase)
 };
 
@@ -16,6 +16,7 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyQString.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
 
 QtnPropertyQStringBase::QtnPropertyQStringBase(QObject *parent)
 	: QtnSinglePropertyBase<QString>(parent)
@@ -40,6 +41,27 @@ bool QtnPropertyQStringBase::toStrImpl(QString &str) const
 	return true;
 }
 
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyQStringBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	QString value;
+	if (!qtnCborReadValue(reader, value))
+	{
+		reader.next();
+		return false;
+	}
+
+	return setValue(value, reason);
+}
+
+bool QtnPropertyQStringBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(value());
+	return true;
+}
+#endif
+
 QtnPropertyQString::QtnPropertyQString(QObject *parent)
 	: QtnSinglePropertyValue<QtnPropertyQStringBase>(parent)
 {
@@ -16,6 +16,8 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyUInt.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
 
 #include <QLocale>
 
@@ -27,10 +29,8 @@ QtnPropertyUIntBase::QtnPropertyUIntBase(QObject *parent)
 bool QtnPropertyUIntBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	bool ok = false;
-	ValueType value = str.toUInt(&ok);
-
-	if (!ok)
+	ValueType value = 0;
+	if (!qtnStrToNumber(str, value))
 		return false;
 
 	return setValue(value, reason);
@@ -38,9 +38,30 @@ bool QtnPropertyUIntBase::fromStrImpl(
 
 bool QtnPropertyUIntBase::toStrImpl(QString &str) const
 {
-	str = QString::number(value());
+	str = qtnNumberToStr(value());
+	return true;
+}
+
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyUIntBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	quint64 value = 0;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
+
+	if (value > std::numeric_limits<ValueType>::max())
+		return false;
+
+	return setValue(ValueType(value), reason);
+}
+
+bool QtnPropertyUIntBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(quint64(value()));
 	return true;
 }
+#endif
 
 QtnPropertyUIntCallback::QtnPropertyUIntCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyUIntBase>(parent)
@@ -295,6 +295,8 @@ void QtnCustomPropertyWidget::propertyOptions()
 						result_data.value.swap(old_data);
 					else
 					{
+						var_property->Materialize();
+
 						switch (var_property->GetType())
 						{
 							case VarProperty::List:
@@ -404,15 +406,37 @@ void QtnCustomPropertyWidget::deleteProperty(QtnPropertyBase *property)
 	{
 		if (var_property != var_property->TopParent())
 		{
+			auto var_parent = var_property->VarParent();
 			var_property->RemoveFromParent();
 
 			auto set = qobject_cast<QtnPropertySet *>(property->parent());
-			auto &set_properties = set->childProperties();
-			auto active_property_index =
-				set_properties.indexOf(propertyView()->activeProperty());
-			updateSet(set,
-				active_property_index >= 0 ? active_property_index
-										   : set_properties.indexOf(property));
+			Q_ASSERT(nullptr != set);
+
+			auto view = propertyView();
+			bool was_active = (view->activeProperty() == property);
+			int index = set->childProperties().indexOf(property);
+
+			set->removeChildProperty(property);
+			delete property;
+
+			if (VarProperty::List == var_parent->GetType())
+				updateElementIndices(set);
+
+			if (was_active)
+			{
+				auto &child_properties = set->childProperties();
+
+				if (child_properties.isEmpty())
+					view->setActiveProperty(set);
+				else
+				{
+					view->setActiveProperty(child_properties.at(
+						qMin(index, child_properties.count() - 1)));
+				}
+			}
+
+			if (autoUpdate)
+				updateData();
 		}
 	}
 }
@@ -576,6 +600,10 @@ bool QtnCustomPropertyWidget::applyPropertyData(const QMimeData *data,
 
 				int insertIndex = varProperty->GetIndex();
 
+				// properties inserted into the same set are added at once
+				QtnPropertyBase *insertDestination = nullptr;
+				std::vector<QtnCustomPropertyData> insertItems;
+
 				if (QtnApplyPosition::Over == position &&
 					varProperty->GetType() == VarProperty::Value)
 				{
@@ -607,7 +635,8 @@ bool QtnCustomPropertyWidget::applyPropertyData(const QMimeData *data,
 									{
 										customData.index = -1;
 										customData.name = it.key();
-										addProperty(parent_prop, customData);
+										insertDestination = parent_prop;
+										insertItems.push_back(customData);
 										ok = true;
 										break;
 									}
@@ -621,7 +650,8 @@ bool QtnCustomPropertyWidget::applyPropertyData(const QMimeData *data,
 										if (QtnApplyPosition::After == position)
 											customData.index++;
 
-										addProperty(parent_prop, customData);
+										insertDestination = parent_prop;
+										insertItems.push_back(customData);
 										ok = true;
 										break;
 									}
@@ -646,7 +676,8 @@ bool QtnCustomPropertyWidget::applyPropertyData(const QMimeData *data,
 								{
 									customData.index = -1;
 									customData.name = it.key();
-									addProperty(destination, customData);
+									insertDestination = destination;
+									insertItems.push_back(customData);
 									ok = true;
 									break;
 								}
@@ -655,8 +686,10 @@ bool QtnCustomPropertyWidget::applyPropertyData(const QMimeData *data,
 								{
 									customData.name.clear();
 									customData.index =
-										varProperty->GetChildrenCount();
-									addProperty(destination, customData);
+										varProperty->GetChildrenCount() +
+										int(insertItems.size());
+									insertDestination = destination;
+									insertItems.push_back(customData);
 									ok = true;
 									break;
 								}
@@ -684,6 +717,9 @@ bool QtnCustomPropertyWidget::applyPropertyData(const QMimeData *data,
 					insertIndex++;
 				}
 
+				if (!insertItems.empty())
+					addProperties(insertDestination, insertItems);
+
 				if (ok)
 					return true;
 			}
@@ -834,54 +870,20 @@ void QtnCustomPropertyWidget::updateData()
 	}
 }
 
-void QtnCustomPropertyWidget::updateSet(
-	QtnPropertyBase *setProperty, int childIndex)
+void QtnCustomPropertyWidget::updateElementIndices(QtnPropertySet *set)
 {
-	Q_ASSERT(nullptr != setProperty);
-
-	auto varProperty = getVarProperty(setProperty);
-	Q_ASSERT(nullptr != varProperty);
-
-	auto data = varProperty->CreateVariant();
-
-	auto var_parent = varProperty->VarParent();
-
-	varProperty->RemoveFromParent();
-
-	auto new_set = newProperty(nullptr, data, varProperty->GetName(),
-		varProperty->GetIndex(), var_parent)
-					   ->asPropertySet();
-
-	Q_ASSERT(nullptr != new_set);
-
-	auto property_parent =
-		qobject_cast<QtnPropertySet *>(setProperty->parent());
-	Q_ASSERT(nullptr != property_parent);
-
-	int property_index =
-		property_parent->childProperties().indexOf(setProperty);
-	property_parent->removeChildProperty(setProperty);
-
-	delete setProperty;
+	Q_ASSERT(nullptr != set);
 
-	property_parent->addChildProperty(new_set, true, property_index);
-	auto view = propertyView();
-	auto &child_properties = new_set->childProperties();
+	auto &child_properties = set->childProperties();
 
-	if (child_properties.isEmpty())
-		view->setActiveProperty(new_set);
-	else
+	for (int i = 0, count = child_properties.count(); i < count; i++)
 	{
-		int count = child_properties.count();
-
-		if (childIndex >= count)
-			childIndex = count - 1;
+		auto property = child_properties.at(i);
+		auto var_property = getVarProperty(property);
 
-		view->setActiveProperty(child_properties.at(childIndex));
+		if (nullptr != var_property && var_property->SetIndex(i))
+			property->setName(var_property->GetName());
 	}
-
-	if (autoUpdate)
-		updateData();
 }
 
 bool QtnCustomPropertyWidget::getActiveVarProperty(
@@ -896,15 +898,10 @@ bool QtnCustomPropertyWidget::getActiveVarProperty(
 
 VarProperty *QtnCustomPropertyWidget::getVarProperty(QtnPropertyBase *source)
 {
-	VarProperty *varProperty = nullptr;
-
 	if (nullptr != source)
-	{
-		varProperty = source->findChild<VarProperty *>(
-			QString(), Qt::FindDirectChildrenOnly);
-	}
+		return source->getVarProperty();
 
-	return varProperty;
+	return nullptr;
 }
 
 QtnPropertyBase *QtnCustomPropertyWidget::newProperty(QtnPropertySet *parent,
@@ -920,6 +917,12 @@ QtnPropertyBase *QtnCustomPropertyWidget::newProperty(QtnPropertySet *parent,
 
 void QtnCustomPropertyWidget::addProperty(
 	QtnPropertyBase *source, const QtnCustomPropertyData &data)
+{
+	addProperties(source, { data });
+}
+
+void QtnCustomPropertyWidget::addProperties(
+	QtnPropertyBase *source, const std::vector<QtnCustomPropertyData> &items)
 {
 	Q_ASSERT(nullptr != source);
 	auto varProperty = getVarProperty(source);
@@ -927,50 +930,61 @@ void QtnCustomPropertyWidget::addProperty(
 	auto set = source->asPropertySet();
 	Q_ASSERT(nullptr != set);
 
-	if (data.index >= 0)
-		Q_ASSERT(data.index <= varProperty->GetChildrenCount());
+	if (items.empty())
+		return;
 
-	auto new_property =
-		newProperty(nullptr, data.value, data.name, data.index, varProperty);
+	auto view = propertyView();
+	view->beginUpdate();
 
-	std::vector<QtnPropertyBase *> children;
+	// indices are given in the full list,
+	// so lazy elements are loaded before inserting
+	varProperty->Materialize();
 
-	for (auto child : set->childProperties())
-	{
-		children.push_back(child);
-	}
+	// several children are spliced with single value update
+	bool batch = items.size() > 1;
 
-	if (data.index >= 0)
-		children.insert(children.begin() + data.index, new_property);
-	else
-		children.push_back(new_property);
+	if (batch)
+		varProperty->BeginUpdate();
 
 	auto isList = (VarProperty::List == varProperty->GetType());
 
-	if (isList)
+	QtnPropertyBase *new_property = nullptr;
+
+	for (auto &data : items)
 	{
-		int count = static_cast<int>(children.size());
+		if (data.index >= 0)
+			Q_ASSERT(data.index <= set->childProperties().count());
+
+		new_property = newProperty(
+			nullptr, data.value, data.name, data.index, varProperty);
 
-		for (int i = 0; i < count; i++)
+		int index = data.index;
+
+		if (!isList)
 		{
-			auto property = children.at(i);
-			auto var_property = getVarProperty(property);
-			var_property->SetIndex(i);
-			property->setName(var_property->GetName());
+			index = 0;
+
+			for (auto child : set->childProperties())
+			{
+				if (QString::localeAwareCompare(
+						child->name(), new_property->name()) < 0)
+				{
+					index++;
+				}
+			}
 		}
-	} else
-	{
-		std::sort(children.begin(), children.end(),
-			[](QtnPropertyBase *a, QtnPropertyBase *b) -> bool {
-				return QString::localeAwareCompare(a->name(), b->name()) < 0;
-			});
+
+		set->addChildProperty(new_property, true, index);
 	}
 
-	auto it = std::find(children.begin(), children.end(), new_property);
+	if (batch)
+		varProperty->EndUpdate();
 
-	set->addChildProperty(new_property, true, int(it - children.begin()));
+	if (isList)
+		updateElementIndices(set);
 
-	propertyView()->setActiveProperty(new_property, true);
+	view->endUpdate();
+	view->setActiveProperty(new_property, true);
 
 	if (autoUpdate)
 		updateData();
@@ -997,64 +1011,44 @@ void QtnCustomPropertyWidget::updatePropertyOptions(
 	auto set = qobject_cast<QtnPropertySet *>(source->parent());
 	Q_ASSERT(nullptr != set);
 
-	bool refresh_siblings = false;
-
-	int old_index = varProperty->GetIndex();
-
 	bool top_property = (varProperty == varProperty->TopParent());
+	auto var_parent = varProperty->VarParent();
+
+	bool moved = false;
 
 	if (!top_property)
 	{
-		refresh_siblings = varProperty->SetIndex(data.index);
-		refresh_siblings = varProperty->SetName(data.name) || refresh_siblings;
+		if (varProperty->GetIndex() >= 0)
+			moved = (data.index != varProperty->GetIndex());
+		else
+			moved = (data.name != varProperty->GetName());
 	}
 
-	auto var_parent = varProperty->VarParent();
+	int index = set->childProperties().indexOf(source);
 
-	if (!refresh_siblings)
-	{
-		int index = set->childProperties().indexOf(source);
-
-		QString prop_name(top_property ? varProperty->GetName() : data.name);
-
-		varProperty->RemoveFromParent();
-		set->removeChildProperty(source);
+	QString prop_name(top_property ? varProperty->GetName() : data.name);
 
-		delete source;
-
-		auto new_property =
-			newProperty(nullptr, data.value, prop_name, data.index, var_parent);
-
-		set->addChildProperty(new_property, true, index);
+	varProperty->RemoveFromParent();
+	set->removeChildProperty(source);
 
-		propertyView()->setActiveProperty(new_property, true);
+	delete source;
 
-		if (autoUpdate)
-			updateData();
-	} else
+	if (moved)
 	{
-		varProperty->SetValue(data.value);
-
-		int index = data.index;
+		if (VarProperty::List == var_parent->GetType())
+			updateElementIndices(set);
 
-		auto children = var_parent->GetChildren();
+		addProperty(set, data);
+		return;
+	}
 
-		if (index < 0)
-		{
-			std::sort(children.begin(), children.end(),
-				[](VarProperty *a, VarProperty *b) -> bool {
-					return QString::localeAwareCompare(
-							   a->GetName(), b->GetName()) < 0;
-				});
+	auto new_property =
+		newProperty(nullptr, data.value, prop_name, data.index, var_parent);
 
-			auto it = std::find(children.begin(), children.end(), varProperty);
+	set->addChildProperty(new_property, true, index);
 
-			index = int(it - children.begin());
-		} else if (old_index != index)
-		{
-			children.at(index)->SetIndex(old_index);
-		}
+	propertyView()->setActiveProperty(new_property, true);
 
-		updateSet(set, index);
-	}
+	if (autoUpdate)
+		updateData();
 }
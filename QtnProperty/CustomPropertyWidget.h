@@ -20,6 +20,8 @@ limitations under the License.
 
 #include <QVariant>
 
+#include <vector>
+
 class VarProperty;
 
 struct QtnCustomPropertyData;
@@ -69,7 +71,7 @@ protected:
 	virtual void dropEnd() override;
 
 private:
-	void updateSet(QtnPropertyBase *setProperty, int childIndex);
+	void updateElementIndices(QtnPropertySet *set);
 
 	bool getActiveVarProperty(
 		QtnPropertyBase *&property, VarProperty *&varProperty);
@@ -78,6 +80,8 @@ private:
 
 	void addProperty(
 		QtnPropertyBase *source, const QtnCustomPropertyData &data);
+	void addProperties(QtnPropertyBase *source,
+		const std::vector<QtnCustomPropertyData> &items);
 	void duplicateProperty(
 		QtnPropertyBase *source, const QtnCustomPropertyData &data);
 	void updatePropertyOptions(
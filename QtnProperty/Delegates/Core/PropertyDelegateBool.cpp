@@ -67,6 +67,11 @@ void QtnPropertyDelegateBoolCheck::Register(QtnPropertyDelegateFactory &factory)
 		qtnCheckBoxDelegate());
 }
 
+bool QtnPropertyDelegateBoolCheck::isShareable() const
+{
+	return true;
+}
+
 bool QtnPropertyDelegateBoolCheck::createSubItemValueImpl(
 	QtnDrawContext &context, QtnSubItem &subItemValue)
 {
@@ -157,11 +162,16 @@ void QtnPropertyDelegateBoolCombobox::Register(
 		qtnComboBoxDelegate());
 }
 
+bool QtnPropertyDelegateBoolCombobox::isShareable() const
+{
+	return true;
+}
+
 void QtnPropertyDelegateBoolCombobox::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
-	info.loadAttribute(qtnLabelFalseAttr(), m_labels[0]);
-	info.loadAttribute(qtnLabelTrueAttr(), m_labels[1]);
+	info.loadAttribute(QtnLabelFalseAttrId, m_labels[0]);
+	info.loadAttribute(QtnLabelTrueAttrId, m_labels[1]);
 }
 
 QWidget *QtnPropertyDelegateBoolCombobox::createValueEditorImpl(
@@ -32,6 +32,8 @@ public:
 
 	static void Register(QtnPropertyDelegateFactory &factory);
 
+	virtual bool isShareable() const override;
+
 protected:
 	bool createSubItemValueImpl(
 		QtnDrawContext &context, QtnSubItem &subItemValue) override;
@@ -47,6 +49,8 @@ public:
 
 	static void Register(QtnPropertyDelegateFactory &factory);
 
+	virtual bool isShareable() const override;
+
 protected:
 	virtual void applyAttributesImpl(
 		const QtnPropertyDelegateInfo &info) override;
@@ -18,6 +18,7 @@ limitations under the License.
 #include "PropertyDelegateDouble.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorAux.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorHandler.h"
+#include "QtnProperty/Utils/InplaceEditing.h"
 #include "QtnProperty/Delegates/Utils/PropertyDelegateSliderBox.h"
 #include "QtnProperty/Delegates/Utils/PropertyDelegateOpacityBox.h"
 #include "QtnProperty/Delegates/PropertyDelegateFactory.h"
@@ -34,6 +35,7 @@ class QtnPropertyDoubleSpinBoxHandler
 public:
 	QtnPropertyDoubleSpinBoxHandler(
 		QtnPropertyDelegateDouble *delegate, QDoubleSpinBox &editor);
+	virtual ~QtnPropertyDoubleSpinBoxHandler() override;
 
 protected:
 	virtual void updateEditor() override;
@@ -70,6 +72,11 @@ void QtnPropertyDelegateDouble::Register(QtnPropertyDelegateFactory &factory)
 		qtnOpacityBoxDelegate());
 }
 
+bool QtnPropertyDelegateDouble::isShareable() const
+{
+	return true;
+}
+
 double QtnPropertyDelegateDouble::stepValue() const
 {
 	return m_step.isValid() ? m_step.toDouble() : owner().stepValue();
@@ -78,7 +85,7 @@ double QtnPropertyDelegateDouble::stepValue() const
 QWidget *QtnPropertyDelegateDouble::createValueEditorImpl(
 	QWidget *parent, const QRect &rect, QtnInplaceInfo *inplaceInfo)
 {
-	auto spinBox = new QtnDoubleSpinBox(parent);
+	auto spinBox = QtnInplaceEditorPool::acquire<QtnDoubleSpinBox>(parent);
 	spinBox->setDecimals(m_precision);
 	spinBox->setSuffix(m_suffix);
 	spinBox->setGeometry(rect);
@@ -116,10 +123,10 @@ bool QtnPropertyDelegateDouble::propertyValueToStrImpl(QString &strValue) const
 void QtnPropertyDelegateDouble::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
-	info.loadAttribute(qtnSuffixAttr(), m_suffix);
-	info.loadAttribute(qtnMultiplierAttr(), m_multiplier);
-	info.loadAttribute(qtnPrecisionAttr(), m_precision);
-	m_step = info.attributes.value(qtnStepAttr());
+	info.loadAttribute(QtnSuffixAttrId, m_suffix);
+	info.loadAttribute(QtnMultiplierAttrId, m_multiplier);
+	info.loadAttribute(QtnPrecisionAttrId, m_precision);
+	m_step = info.attributeValue(QtnStepAttrId);
 	if (m_step.isValid())
 	{
 		bool ok;
@@ -134,8 +141,8 @@ void QtnPropertyDelegateDouble::applyAttributesImpl(
 	}
 	m_precision = qBound(0, m_precision, std::numeric_limits<double>::digits10);
 
-	m_min = info.attributes.value(qtnMinAttr());
-	m_max = info.attributes.value(qtnMaxAttr());
+	m_min = info.attributeValue(QtnMinAttrId);
+	m_max = info.attributeValue(QtnMaxAttrId);
 
 	if (!qIsFinite(m_multiplier) || qFuzzyCompare(m_multiplier, 0.0))
 	{
@@ -175,12 +182,21 @@ QtnPropertyDoubleSpinBoxHandler::QtnPropertyDoubleSpinBoxHandler(
 
 	editor.setKeyboardTracking(false);
 	editor.installEventFilter(this);
+	coalesceUpdates = true;
+	QObject::connect(&editor, &QAbstractSpinBox::editingFinished, this,
+		&QtnPropertyDoubleSpinBoxHandler::flushValue);
 	QObject::connect(&editor,
 		static_cast<void (QDoubleSpinBox::*)(double)>(
 			&QDoubleSpinBox::valueChanged),
 		this, &QtnPropertyDoubleSpinBoxHandler::onValueChanged);
 }
 
+QtnPropertyDoubleSpinBoxHandler::~QtnPropertyDoubleSpinBoxHandler()
+{
+	// apply with multiplier
+	flushValue();
+}
+
 void QtnPropertyDoubleSpinBoxHandler::updateEditor()
 {
 	updating++;
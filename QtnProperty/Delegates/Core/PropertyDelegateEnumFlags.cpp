@@ -23,7 +23,12 @@ limitations under the License.
 
 #include <QLineEdit>
 
-static QString enumFlagsProperty2Str(const QtnPropertyEnumFlagsBase &property)
+#include <algorithm>
+
+// When more than maxFlags flags are set, returns a summary
+// with names of the first maxFlags flags and the count of set flags.
+static QString enumFlagsProperty2Str(
+	const QtnPropertyEnumFlagsBase &property, int maxFlags = -1)
 {
 	QString text;
 
@@ -32,20 +37,29 @@ static QString enumFlagsProperty2Str(const QtnPropertyEnumFlagsBase &property)
 	if (nullptr == enumInfo)
 		return text;
 
-	auto value = property.value();
+	QVector<const QtnEnumValueInfo *> values;
+	enumInfo->collectFlagValues(property.value(), values);
 
-	if (value == 0)
-		return text;
+	int count = values.size();
+	if (maxFlags >= 0 && count > maxFlags)
+		values.resize(maxFlags);
 
-	for (const QtnEnumValueInfo &e : enumInfo->getVector())
+	for (auto e : values)
 	{
-		if (value & e.value())
-		{
-			if (!text.isEmpty())
-				text += "|";
+		if (!text.isEmpty())
+			text += "|";
 
-			text += e.displayName();
-		}
+		text += e->displayName();
+	}
+
+	if (values.size() < count)
+	{
+		auto &vector = enumInfo->getVector();
+		int total = int(std::count_if(vector.begin(), vector.end(),
+			[](const QtnEnumValueInfo &e) -> bool {
+				return e.state() == QtnEnumValueStateNone;
+			}));
+		text = QtnPropertyEnumFlags::getFlagsSummary(text, count, total);
 	}
 
 	return text;
@@ -65,40 +79,8 @@ protected:
 QtnPropertyDelegateEnumFlags::QtnPropertyDelegateEnumFlags(
 	QtnPropertyEnumFlagsBase &owner)
 	: QtnPropertyDelegateTypedEx<QtnPropertyEnumFlagsBase>(owner)
+	, m_flagPropertiesCreated(false)
 {
-	const QtnEnumInfo *enumInfo = owner.enumInfo();
-
-	if (enumInfo)
-	{
-		for (const QtnEnumValueInfo &e : enumInfo->getVector())
-		{
-			if (e.state() == QtnEnumValueStateNone)
-			{
-				QtnEnumValueType enumValue = e.value();
-
-				auto flagProperty = new QtnPropertyBoolCallback;
-				flagProperty->setDisplayName(e.displayName());
-				flagProperty->setName(e.name());
-				flagProperty->setDescription(
-					QtnPropertyEnumFlags::getFlagLabelDescription(
-						e.displayName(), owner.displayName()));
-
-				flagProperty->setCallbackValueGet(
-					[&owner, enumValue]() -> bool {
-						return owner.value() & enumValue;
-					});
-				flagProperty->setCallbackValueSet(
-					[&owner, enumValue](bool value, QtnPropertyChangeReason reason) {
-						if (value)
-							owner.setValue(owner.value() | enumValue, reason);
-						else
-							owner.setValue(owner.value() & ~enumValue, reason);
-					});
-
-				addSubProperty(flagProperty);
-			}
-		}
-	}
 }
 
 void QtnPropertyDelegateEnumFlags::Register(QtnPropertyDelegateFactory &factory)
@@ -109,6 +91,73 @@ void QtnPropertyDelegateEnumFlags::Register(QtnPropertyDelegateFactory &factory)
 		QByteArrayLiteral("FlagsList"));
 }
 
+int QtnPropertyDelegateEnumFlags::subPropertyCountImpl() const
+{
+	// flag properties are created on first request
+	const_cast<QtnPropertyDelegateEnumFlags *>(this)->createFlagProperties();
+	return QtnPropertyDelegateTypedEx::subPropertyCountImpl();
+}
+
+QtnPropertyBase *QtnPropertyDelegateEnumFlags::subPropertyImpl(int index)
+{
+	createFlagProperties();
+	return QtnPropertyDelegateTypedEx::subPropertyImpl(index);
+}
+
+bool QtnPropertyDelegateEnumFlags::hasLazySubPropertiesImpl() const
+{
+	return true;
+}
+
+void QtnPropertyDelegateEnumFlags::releaseSubPropertiesImpl()
+{
+	m_subProperties.clear();
+	m_flagPropertiesCreated = false;
+}
+
+void QtnPropertyDelegateEnumFlags::createFlagProperties()
+{
+	if (m_flagPropertiesCreated)
+		return;
+
+	m_flagPropertiesCreated = true;
+
+	auto &owner = this->owner();
+	const QtnEnumInfo *enumInfo = owner.enumInfo();
+
+	if (!enumInfo)
+		return;
+
+	for (const QtnEnumValueInfo &e : enumInfo->getVector())
+	{
+		if (e.state() != QtnEnumValueStateNone)
+			continue;
+
+		QtnEnumValueType enumValue = e.value();
+
+		auto flagProperty = new QtnPropertyBoolCallback;
+		flagProperty->setDisplayName(e.displayName());
+		flagProperty->setName(e.name());
+		flagProperty->setDescription(
+			QtnPropertyEnumFlags::getFlagLabelDescription(
+				e.displayName(), owner.displayName()));
+
+		flagProperty->setCallbackValueGet(
+			[&owner, enumValue]() -> bool {
+				return owner.value() & enumValue;
+			});
+		flagProperty->setCallbackValueSet(
+			[&owner, enumValue](bool value, QtnPropertyChangeReason reason) {
+				if (value)
+					owner.setValue(owner.value() | enumValue, reason);
+				else
+					owner.setValue(owner.value() & ~enumValue, reason);
+			});
+
+		addSubProperty(flagProperty);
+	}
+}
+
 QWidget *QtnPropertyDelegateEnumFlags::createValueEditorImpl(
 	QWidget *parent, const QRect &rect, QtnInplaceInfo *inplaceInfo)
 {
@@ -128,7 +177,14 @@ QWidget *QtnPropertyDelegateEnumFlags::createValueEditorImpl(
 bool QtnPropertyDelegateEnumFlags::propertyValueToStrImpl(
 	QString &strValue) const
 {
-	strValue = enumFlagsProperty2Str(owner());
+	enum
+	{
+		MaxSummaryFlags = 3
+	};
+
+	// collapsed row shows a few flag names only
+	strValue = enumFlagsProperty2Str(owner(),
+		stateProperty()->isCollapsed() ? MaxSummaryFlags : -1);
 	return true;
 }
 
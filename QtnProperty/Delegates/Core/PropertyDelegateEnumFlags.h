@@ -32,10 +32,20 @@ public:
 	static void Register(QtnPropertyDelegateFactory &factory);
 
 protected:
+	virtual int subPropertyCountImpl() const override;
+	virtual QtnPropertyBase *subPropertyImpl(int index) override;
+	virtual bool hasLazySubPropertiesImpl() const override;
+	virtual void releaseSubPropertiesImpl() override;
+
 	virtual QWidget *createValueEditorImpl(QWidget *parent, const QRect &rect,
 		QtnInplaceInfo *inplaceInfo = nullptr) override;
 
 	virtual bool propertyValueToStrImpl(QString &strValue) const override;
+
+private:
+	void createFlagProperties();
+
+	bool m_flagPropertiesCreated;
 };
 
 #endif // PROPERTY_DELEGATE_ENUM_FLAGS_H
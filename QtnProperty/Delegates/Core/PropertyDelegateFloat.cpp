@@ -18,6 +18,7 @@ limitations under the License.
 #include "PropertyDelegateFloat.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorAux.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorHandler.h"
+#include "QtnProperty/Utils/InplaceEditing.h"
 #include "QtnProperty/Delegates/Utils/PropertyDelegateSliderBox.h"
 #include "QtnProperty/Delegates/Utils/PropertyDelegateOpacityBox.h"
 #include "QtnProperty/Delegates/PropertyDelegateFactory.h"
@@ -47,16 +48,22 @@ public:
 
 	QtnPropertyFloatSpinBoxHandler(
 		QtnPropertyDelegateFloat *delegate, QDoubleSpinBox &editor);
+	virtual ~QtnPropertyFloatSpinBoxHandler() override;
 
 	void onValueChanged(double value);
 
 	virtual void updateEditor() override;
 	void updateValue();
 
+protected:
+	virtual void revertInput() override;
+
 private:
 	QtnPropertyDelegateFloat *m_delegate;
 	double newValue;
 	unsigned updating;
+	// limit rate of updates from key repeat and wheel
+	QtnUpdateCoalescer valueUpdates;
 };
 
 QtnPropertyDelegateFloat::QtnPropertyDelegateFloat(QtnPropertyFloatBase &owner)
@@ -85,6 +92,11 @@ void QtnPropertyDelegateFloat::Register(QtnPropertyDelegateFactory &factory)
 		qtnOpacityBoxDelegate());
 }
 
+bool QtnPropertyDelegateFloat::isShareable() const
+{
+	return true;
+}
+
 double QtnPropertyDelegateFloat::stepValue() const
 {
 	if (m_step.isValid())
@@ -99,7 +111,7 @@ double QtnPropertyDelegateFloat::stepValue() const
 QWidget *QtnPropertyDelegateFloat::createValueEditorImpl(
 	QWidget *parent, const QRect &rect, QtnInplaceInfo *inplaceInfo)
 {
-	auto spinBox = new QtnDoubleSpinBox(parent);
+	auto spinBox = QtnInplaceEditorPool::acquire<QtnDoubleSpinBox>(parent);
 	spinBox->setDecimals(m_precision);
 	spinBox->setSuffix(m_suffix);
 	spinBox->setGeometry(rect);
@@ -137,11 +149,11 @@ bool QtnPropertyDelegateFloat::propertyValueToStrImpl(QString &strValue) const
 void QtnPropertyDelegateFloat::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
-	info.loadAttribute(qtnSuffixAttr(), m_suffix);
-	info.loadAttribute(qtnMultiplierAttr(), m_multiplier);
-	info.loadAttribute(qtnPrecisionAttr(), m_precision);
+	info.loadAttribute(QtnSuffixAttrId, m_suffix);
+	info.loadAttribute(QtnMultiplierAttrId, m_multiplier);
+	info.loadAttribute(QtnPrecisionAttrId, m_precision);
 
-	m_step = info.attributes.value(qtnStepAttr());
+	m_step = info.attributeValue(QtnStepAttrId);
 	if (m_step.isValid())
 	{
 		bool ok;
@@ -157,8 +169,8 @@ void QtnPropertyDelegateFloat::applyAttributesImpl(
 
 	m_precision = qBound(0, m_precision, std::numeric_limits<float>::digits10);
 
-	m_min = info.attributes.value(qtnMinAttr());
-	m_max = info.attributes.value(qtnMaxAttr());
+	m_min = info.attributeValue(QtnMinAttrId);
+	m_max = info.attributeValue(QtnMaxAttrId);
 
 	if (!qIsFinite(m_multiplier) || qFuzzyCompare(m_multiplier, 0.0))
 	{
@@ -200,18 +212,31 @@ QtnPropertyFloatSpinBoxHandler::QtnPropertyFloatSpinBoxHandler(
 
 	editor.setKeyboardTracking(false);
 	editor.installEventFilter(this);
+	QObject::connect(&editor, &QAbstractSpinBox::editingFinished, this,
+		[this]() { valueUpdates.flush(); });
 	QObject::connect(&editor,
 		static_cast<void (QDoubleSpinBox::*)(double)>(
 			&QDoubleSpinBox::valueChanged),
 		this, &QtnPropertyFloatSpinBoxHandler::onValueChanged);
 }
 
+QtnPropertyFloatSpinBoxHandler::~QtnPropertyFloatSpinBoxHandler()
+{
+	valueUpdates.flush();
+}
+
+void QtnPropertyFloatSpinBoxHandler::revertInput()
+{
+	valueUpdates.cancel();
+	Inherited::revertInput();
+}
+
 void QtnPropertyFloatSpinBoxHandler::onValueChanged(double value)
 {
 	if (updating > 0)
 		return;
 	newValue = value;
-	updateValue();
+	valueUpdates.post([this]() { updateValue(); });
 }
 
 void QtnPropertyFloatSpinBoxHandler::updateEditor()
@@ -36,6 +36,8 @@ public:
 
 	static void Register(QtnPropertyDelegateFactory &factory);
 
+	virtual bool isShareable() const override;
+
 	double stepValue() const;
 	double minValue() const;
 	double maxValue() const;
@@ -18,6 +18,7 @@ limitations under the License.
 #include "PropertyDelegateInt.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorAux.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorHandler.h"
+#include "QtnProperty/Utils/InplaceEditing.h"
 #include "QtnProperty/Delegates/Utils/PropertyDelegateSliderBox.h"
 #include "QtnProperty/Delegates/Utils/PropertyDelegateOpacityBox.h"
 #include "QtnProperty/Delegates/PropertyDelegateFactory.h"
@@ -108,6 +109,11 @@ void QtnPropertyDelegateInt::Register(QtnPropertyDelegateFactory &factory)
 		qtnOpacityBoxDelegate());
 }
 
+bool QtnPropertyDelegateInt::isShareable() const
+{
+	return true;
+}
+
 int QtnPropertyDelegateInt::stepValue() const
 {
 	return m_step.isValid() ? m_step.toInt() : owner().stepValue();
@@ -131,7 +137,7 @@ int QtnPropertyDelegateInt::currentValue() const
 QWidget *QtnPropertyDelegateInt::createValueEditorImpl(
 	QWidget *parent, const QRect &rect, QtnInplaceInfo *inplaceInfo)
 {
-	auto spinBox = new QtnSpinBox(parent);
+	auto spinBox = QtnInplaceEditorPool::acquire<QtnSpinBox>(parent);
 	spinBox->setSuffix(m_suffix);
 	spinBox->setGeometry(rect);
 
@@ -160,10 +166,10 @@ bool QtnPropertyDelegateInt::acceptKeyPressedForInplaceEditImpl(
 void QtnPropertyDelegateInt::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
-	info.loadAttribute(qtnSuffixAttr(), m_suffix);
-	m_min = info.attributes.value(qtnMinAttr());
-	m_max = info.attributes.value(qtnMaxAttr());
-	m_step = info.attributes.value(qtnStepAttr());
+	info.loadAttribute(QtnSuffixAttrId, m_suffix);
+	m_min = info.attributeValue(QtnMinAttrId);
+	m_max = info.attributeValue(QtnMaxAttrId);
+	m_step = info.attributeValue(QtnStepAttrId);
 	if (m_step.isValid())
 	{
 		bool ok;
@@ -195,6 +201,9 @@ QtnPropertyIntSpinBoxHandler::QtnPropertyIntSpinBoxHandler(
 
 	editor.setKeyboardTracking(false);
 	editor.installEventFilter(this);
+	coalesceUpdates = true;
+	QObject::connect(&editor, &QAbstractSpinBox::editingFinished, this,
+		&QtnPropertyIntSpinBoxHandler::flushValue);
 	QObject::connect(&editor,
 		static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged), this,
 		&QtnPropertyIntSpinBoxHandler::onValueChanged);
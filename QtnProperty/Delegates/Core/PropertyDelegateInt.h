@@ -36,6 +36,8 @@ public:
 
 	static void Register(QtnPropertyDelegateFactory &factory);
 
+	virtual bool isShareable() const override;
+
 	int stepValue() const;
 	int minValue() const;
 	int maxValue() const;
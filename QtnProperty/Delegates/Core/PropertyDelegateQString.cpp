@@ -226,12 +226,17 @@ void QtnPropertyDelegateQString::Register(QtnPropertyDelegateFactory &factory)
 		qtnLineEditDelegate());
 }
 
+bool QtnPropertyDelegateQString::isShareable() const
+{
+	return true;
+}
+
 void QtnPropertyDelegateQString::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
-	info.loadAttribute(qtnMultiLineEditAttr(), m_multiline);
-	info.loadAttribute(qtnMaxLengthAttr(), m_maxLength);
-	info.loadAttribute(qtnPlaceholderAttr(), m_placeholder);
+	info.loadAttribute(QtnMultiLineEditAttrId, m_multiline);
+	info.loadAttribute(QtnMaxLengthAttrId, m_maxLength);
+	info.loadAttribute(QtnPlaceholderAttrId, m_placeholder);
 }
 
 bool QtnPropertyDelegateQString::acceptKeyPressedForInplaceEditImpl(
@@ -263,7 +268,7 @@ QWidget *QtnPropertyDelegateQString::createValueEditorImpl(
 		return editor;
 	}
 
-	QLineEdit *lineEdit = new QLineEdit(parent);
+	auto lineEdit = QtnInplaceEditorPool::acquire<QLineEdit>(parent);
 	lineEdit->setMaxLength(m_maxLength);
 	lineEdit->setPlaceholderText(m_placeholder);
 	lineEdit->setGeometry(rect);
@@ -32,6 +32,8 @@ public:
 	QtnPropertyDelegateQString(QtnPropertyQStringBase &owner);
 
 	static void Register(QtnPropertyDelegateFactory &factory);
+
+	virtual bool isShareable() const override;
   
 protected:
 	virtual void applyAttributesImpl(
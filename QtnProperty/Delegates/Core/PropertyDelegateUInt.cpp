@@ -18,6 +18,7 @@ limitations under the License.
 #include "PropertyDelegateUInt.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorAux.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorHandler.h"
+#include "QtnProperty/Utils/InplaceEditing.h"
 #include "QtnProperty/Delegates/Utils/PropertyDelegateSliderBox.h"
 #include "QtnProperty/Delegates/Utils/PropertyDelegateOpacityBox.h"
 #include "QtnProperty/Delegates/PropertyDelegateFactory.h"
@@ -67,6 +68,11 @@ void QtnPropertyDelegateUInt::Register(QtnPropertyDelegateFactory &factory)
 		qtnOpacityBoxDelegate());
 }
 
+bool QtnPropertyDelegateUInt::isShareable() const
+{
+	return true;
+}
+
 uint QtnPropertyDelegateUInt::stepValue() const
 {
 	return m_step.isValid() ? m_step.toUInt() : owner().stepValue();
@@ -90,7 +96,7 @@ uint QtnPropertyDelegateUInt::currentValue() const
 QWidget *QtnPropertyDelegateUInt::createValueEditorImpl(
 	QWidget *parent, const QRect &rect, QtnInplaceInfo *inplaceInfo)
 {
-	auto spinBox = new QtnInt64SpinBox(parent);
+	auto spinBox = QtnInplaceEditorPool::acquire<QtnInt64SpinBox>(parent);
 	spinBox->setSuffix(m_suffix);
 	spinBox->setGeometry(rect);
 
@@ -117,10 +123,10 @@ bool QtnPropertyDelegateUInt::acceptKeyPressedForInplaceEditImpl(
 void QtnPropertyDelegateUInt::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
-	info.loadAttribute(qtnSuffixAttr(), m_suffix);
-	m_min = info.attributes.value(qtnMinAttr());
-	m_max = info.attributes.value(qtnMaxAttr());
-	m_step = info.attributes.value(qtnStepAttr());
+	info.loadAttribute(QtnSuffixAttrId, m_suffix);
+	m_min = info.attributeValue(QtnMinAttrId);
+	m_max = info.attributeValue(QtnMaxAttrId);
+	m_step = info.attributeValue(QtnStepAttrId);
 	if (m_step.isValid())
 	{
 		bool ok;
@@ -152,6 +158,9 @@ QtnPropertyUIntSpinBoxHandler::QtnPropertyUIntSpinBoxHandler(
 
 	editor.setKeyboardTracking(false);
 	editor.installEventFilter(this);
+	coalesceUpdates = true;
+	QObject::connect(&editor, &QAbstractSpinBox::editingFinished, this,
+		&QtnPropertyUIntSpinBoxHandler::flushValue);
 	QObject::connect(&editor,
 		static_cast<void (QtnInt64SpinBox::*)(qint64)>(
 			&QtnInt64SpinBox::valueChanged),
@@ -36,6 +36,8 @@ public:
 
 	static void Register(QtnPropertyDelegateFactory &factory);
 
+	virtual bool isShareable() const override;
+
 	uint stepValue() const;
 	uint minValue() const;
 	uint maxValue() const;
@@ -180,8 +180,7 @@ void QtnPropertyDelegateButtonLink::createSubItemsImpl(
 
 		context.painter->setPen(linkColor);
 
-		context.painter->drawText(
-			item.rect, Qt::AlignLeading | Qt::AlignVCenter, m_title);
+		qtnDrawText(*context.painter, m_title, item.rect);
 
 		context.painter->restore();
 	};
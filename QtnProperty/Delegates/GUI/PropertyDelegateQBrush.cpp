@@ -21,6 +21,7 @@ limitations under the License.
 #include "QtnProperty/Delegates/Utils/PropertyEditorHandler.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorAux.h"
 #include "QtnProperty/PropertyDelegateAttrs.h"
+#include "QtnProperty/Utils/QtnSwatchCache.h"
 
 #include <QComboBox>
 #include <QStyledItemDelegate>
@@ -60,13 +61,9 @@ static void drawBrushStyle(
 
 		default:
 		{
-			rect.adjust(2, 2, -2, -2);
-			auto brush = painter.brush();
-			brush.setStyle(brushStyle);
-			auto oldBrush = painter.brush();
-			painter.setBrush(brush);
-			painter.drawRect(rect);
-			painter.setBrush(oldBrush);
+			// drawRect outline covers one more pixel than the rect
+			QtnSwatchCache::drawBrushStyle(
+				painter, rect.adjusted(2, 2, -1, -1), brushStyle);
 		}
 	}
 }
@@ -19,11 +19,12 @@ limitations under the License.
 #include "QtnProperty/Delegates/PropertyDelegateFactory.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorHandler.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorAux.h"
+#include "QtnProperty/Delegates/Utils/PropertyDialogSession.h"
 #include "QtnProperty/PropertyDelegateAttrs.h"
 #include "QtnProperty/Utils/InplaceEditing.h"
+#include "QtnProperty/Utils/QtnSwatchCache.h"
 
 #include <QColorDialog>
-#include <QPainterPath>
 #include <QApplication>
 
 QByteArray qtnShapeAttr()
@@ -111,25 +112,17 @@ void QtnPropertyDelegateQColor::drawValueImpl(
 
 		if (m_shape == QtnColorDelegateShapeSquare)
 		{
-			painter.fillRect(colorRect,
+			QtnSwatchCache::drawColor(painter, colorRect, value,
+				QtnSwatchShapeSquare,
 				painter.style()->standardPalette().color(
 					stateProperty()->isEditableByUser() ? QPalette::Active
 														: QPalette::Disabled,
 					QPalette::Text));
-			colorRect.adjust(1, 1, -1, -1);
-			painter.fillRect(colorRect, value);
 		} else if (m_shape == QtnColorDelegateShapeCircle)
 		{
-			auto oldBrush = painter.brush();
-			bool oldAntiAliasing =
-				painter.testRenderHint(QPainter::Antialiasing);
-			painter.setRenderHint(QPainter::Antialiasing);
-
-			painter.setBrush(value);
-			painter.drawEllipse(colorRect);
-
-			painter.setRenderHint(QPainter::Antialiasing, oldAntiAliasing);
-			painter.setBrush(oldBrush);
+			// ellipse outline covers one more pixel than colorRect
+			QtnSwatchCache::drawColor(painter, colorRect.adjusted(0, 0, 1, 1),
+				value, QtnSwatchShapeCircle, painter.pen().color());
 		}
 
 		textRect.setLeft(colorRect.right() + 3);
@@ -209,12 +202,8 @@ void QtnPropertyDelegateQColorSolid::drawValueImpl(
   painter.save();
   painter.setRenderHint(QPainter::Antialiasing);
   
-  QPainterPath clip_path;
-  clip_path.addRoundedRect(boxRect.adjusted(1, 1, -1, -1), 2, 2);
-  painter.setClipPath(clip_path);
-  
-  painter.fillRect(boxRect, owner());
-  painter.setClipping(false);
+  QtnSwatchCache::drawColor(
+      painter, boxRect, owner().value(), QtnSwatchShapeRoundedRect);
   
   QStyleOptionFrame option;
   option.rect = boxRect;
@@ -253,10 +242,14 @@ QWidget *QtnPropertyDelegateQColorSolid::createValueEditorImpl(
 		return nullptr;
 	}
 
-	QColorDialog dlg(owner(), parent);
-	if (dlg.exec() == QDialog::Accepted)
+	auto property = &owner();
+	if (!QtnPropertyDialogSession::activate(property))
 	{
-		owner().setValue(dlg.currentColor(), editReason());
+		auto dialog = new QColorDialog(property->value());
+		QtnPropertyDialogSession::open(dialog, property, editReason(), parent,
+			[property, dialog](QtnPropertyChangeReason reason) {
+				property->setValue(dialog->currentColor(), reason);
+			});
 	}
 
 	return nullptr;
@@ -296,15 +289,16 @@ void QtnPropertyQColorLineEditBttnHandler::updateEditor()
 void QtnPropertyQColorLineEditBttnHandler::onToolButtonClicked(bool)
 {
 	auto property = &this->property();
-	volatile bool destroyed = false;
-	auto connection = QObject::connect(property, &QObject::destroyed,
-		[&destroyed]() mutable { destroyed = true; });
 	reverted = true;
 
 	// Try callback first
 	auto cb = qtnResolveColorCallback(editorBase());
 	if (cb)
 	{
+		volatile bool destroyed = false;
+		auto connection = QObject::connect(property, &QObject::destroyed,
+			[&destroyed]() mutable { destroyed = true; });
+
 		QPoint screenBL = editor().toolButton->mapToGlobal(QPoint(0, editor().toolButton->height()));
 		QColor chosen = cb(screenBL, property->value(), property->name());
 		if (chosen.isValid() && !destroyed)
@@ -316,18 +310,15 @@ void QtnPropertyQColorLineEditBttnHandler::onToolButtonClicked(bool)
 		return;
 	}
 
-	auto dialog = new QColorDialog(property->value(), editorBase());
-	auto dialogContainer = connectDialog(dialog);
-
-	if (dialog->exec() == QDialog::Accepted && !destroyed)
-	{
-		property->setValue(dialog->currentColor(), delegate()->editReason());
-	}
-
-	if (!destroyed)
-		QObject::disconnect(connection);
+	if (QtnPropertyDialogSession::activate(property))
+		return;
 
-	Q_UNUSED(dialogContainer);
+	auto dialog = new QColorDialog(property->value());
+	QtnPropertyDialogSession::open(dialog, property,
+		delegate()->editReason(), editorBase(),
+		[property, dialog](QtnPropertyChangeReason reason) {
+			property->setValue(dialog->currentColor(), reason);
+		});
 }
 
 void QtnPropertyQColorLineEditBttnHandler::onEditingFinished()
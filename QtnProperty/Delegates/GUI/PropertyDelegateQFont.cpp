@@ -23,8 +23,10 @@ limitations under the License.
 #include "QtnProperty/Delegates/PropertyDelegateFactory.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorHandler.h"
 #include "QtnProperty/Delegates/Utils/PropertyEditorAux.h"
+#include "QtnProperty/Delegates/Utils/PropertyDialogSession.h"
 #include "QtnProperty/PropertySet.h"
 #include "QtnProperty/PropertyDelegateAttrs.h"
+#include "QtnProperty/Auxiliary/PropertyEnumRegistry.h"
 
 #include <QFontDialog>
 #include <QFontDatabase>
@@ -51,10 +53,7 @@ private:
 
 static const QtnEnumInfo *styleStrategyEnum()
 {
-	static QScopedPointer<QtnEnumInfo> enumInfo;
-
-	if (nullptr == enumInfo)
-	{
+	static const int id = QtnEnumRegistry::registerEnum([]() -> QtnEnumInfo {
 		QVector<QtnEnumValueInfo> items;
 		items.append(QtnEnumValueInfo(QFont::PreferDefault, "PreferDefault",
 			QtnPropertyQFont::getPreferDefaultStr()));
@@ -62,10 +61,10 @@ static const QtnEnumInfo *styleStrategyEnum()
 			QtnPropertyQFont::getNoAntialiasStr()));
 		items.append(QtnEnumValueInfo(QFont::PreferAntialias, "PreferAntialias",
 			QtnPropertyQFont::getPreferAntialiasStr()));
-		enumInfo.reset(new QtnEnumInfo("FontStyleStrategy", items));
-	}
+		return QtnEnumInfo("FontStyleStrategy", items);
+	});
 
-	return enumInfo.data();
+	return &QtnEnumRegistry::enumInfo(id);
 }
 
 enum
@@ -76,19 +75,16 @@ enum
 
 static const QtnEnumInfo *sizeUnitEnum()
 {
-	static QScopedPointer<QtnEnumInfo> enumInfo;
-
-	if (nullptr == enumInfo)
-	{
+	static const int id = QtnEnumRegistry::registerEnum([]() -> QtnEnumInfo {
 		QVector<QtnEnumValueInfo> items;
 		items.append(QtnEnumValueInfo(
 			SizeUnitPixel, "Pixel", QtnPropertyQFont::getPixelStr()));
 		items.append(QtnEnumValueInfo(
 			SizeUnitPoint, "Point", QtnPropertyQFont::getPointStr()));
-		enumInfo.reset(new QtnEnumInfo("FontSizeUnit", items));
-	}
+		return QtnEnumInfo("FontSizeUnit", items);
+	});
 
-	return enumInfo.data();
+	return &QtnEnumRegistry::enumInfo(id);
 }
 
 static void applyFontStyle(QFont &font)
@@ -520,30 +516,23 @@ void QtnPropertyQFontLineEditBttnHandler::updateEditor()
 void QtnPropertyQFontLineEditBttnHandler::onToolButtonClicked(bool)
 {
 	auto property = &this->property();
-	volatile bool destroyed = false;
-	auto connection = QObject::connect(property, &QObject::destroyed,
-		[&destroyed]() mutable { destroyed = true; });
-	auto dialog = new QFontDialog(property->value(), editorBase());
-	auto dialogContainer = connectDialog(dialog);
-
-	if (dialog->exec() == QDialog::Accepted && !destroyed)
-	{
-		auto font = property->value();
-		auto styleStrategy = font.styleStrategy();
-		int pixelSize = font.pixelSize();
-		font = dialog->currentFont();
-
-		if (pixelSize > 0)
-			font.setPixelSize(font.pointSize());
+	if (QtnPropertyDialogSession::activate(property))
+		return;
 
-		font.setStyleStrategy(styleStrategy);
+	auto dialog = new QFontDialog(property->value());
+	QtnPropertyDialogSession::open(dialog, property,
+		delegate()->editReason() | QtnPropertyChangeReasonChildren,
+		editorBase(), [property, dialog](QtnPropertyChangeReason reason) {
+			auto font = property->value();
+			auto styleStrategy = font.styleStrategy();
+			int pixelSize = font.pixelSize();
+			font = dialog->currentFont();
 
-		property->setValue(
-			font, delegate()->editReason() | QtnPropertyChangeReasonChildren);
-	}
+			if (pixelSize > 0)
+				font.setPixelSize(font.pointSize());
 
-	if (!destroyed)
-		QObject::disconnect(connection);
+			font.setStyleStrategy(styleStrategy);
 
-	Q_UNUSED(dialogContainer);
+			property->setValue(font, reason);
+		});
 }
@@ -25,6 +25,7 @@ limitations under the License.
 #include "QtnProperty/Core/PropertyEnum.h"
 #include "QtnProperty/GUI/PropertyQColor.h"
 #include "QtnProperty/MultiProperty.h"
+#include "QtnProperty/Utils/QtnSwatchCache.h"
 
 #include <QComboBox>
 #include <QStyledItemDelegate>
@@ -68,16 +69,11 @@ void QtnPropertyDelegateQPenStyle::Register(QtnPropertyDelegateFactory &factory)
 		qtnComboBoxDelegate());
 }
 
-static void drawPenStyle(QPainter &painter, QRect rect, Qt::PenStyle penStyle)
+static void drawPenStyle(
+	QPainter &painter, const QRect &rect, Qt::PenStyle penStyle)
 {
-	rect.adjust(2, 2, -2, -2);
-	QPen pen = painter.pen();
-	pen.setStyle(penStyle);
-	painter.save();
-	painter.setPen(pen);
-	auto midY = rect.center().y();
-	painter.drawLine(rect.left(), midY, rect.right(), midY);
-	painter.restore();
+	QtnSwatchCache::drawPenStyle(
+		painter, rect.adjusted(2, 2, -2, -2), penStyle);
 }
 
 class QtnPropertyPenStyleItemDelegate : public QStyledItemDelegate
@@ -106,6 +106,20 @@ bool QtnPropertyDelegate::isSplittable() const
 	return false;
 }
 
+bool QtnPropertyDelegate::isShareable() const
+{
+	return false;
+}
+
+void QtnPropertyDelegate::bindProperty(QtnPropertyBase &owner)
+{
+	Q_ASSERT(isShareable());
+	// shared delegate should never have in-place editor
+	Q_ASSERT(!m_editorHandler);
+	m_ownerProperty = &owner;
+	m_stateProperty = nullptr;
+}
+
 int QtnPropertyDelegate::subPropertyCountImpl() const
 {
 	return 0;
@@ -117,12 +131,27 @@ QtnPropertyBase *QtnPropertyDelegate::subPropertyImpl(int index)
 	return nullptr;
 }
 
+bool QtnPropertyDelegate::hasLazySubPropertiesImpl() const
+{
+	return false;
+}
+
+void QtnPropertyDelegate::releaseSubPropertiesImpl()
+{
+	// do nothing
+}
+
 void QtnPropertyDelegate::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
 	Q_UNUSED(info);
 }
 
+int QtnPropertyDelegate::rowHeightImpl(int defaultHeight) const
+{
+	return defaultHeight;
+}
+
 QStyle::State QtnPropertyDelegate::state(
 	bool isActive, const QtnSubItem &subItem) const
 {
@@ -206,6 +235,14 @@ QColor QtnPropertyDelegate::disabledTextColor(const QStylePainter &painter)
 // #endif
 }
 
+bool QtnPropertyDelegate::isBranchCollapsed(const QtnPropertyView *view) const
+{
+	if (view)
+		return view->isBranchCollapsed(stateProperty());
+
+	return stateProperty()->isCollapsed();
+}
+
 void QtnPropertyDelegate::addSubItemBranchNode(
 	QtnDrawContext &context, QList<QtnSubItem> &subItems)
 {
@@ -237,7 +274,7 @@ void QtnPropertyDelegate::addSubItemBranchNode(
 		branchRect.translate(-side, 0);
 		
 		QPainterPath branchPath;
-		if (stateProperty()->isCollapsed())
+		if (isBranchCollapsed(context.widget))
 		{
 			branchPath.moveTo(
 				branchRect.left() + side, branchRect.top() + side);
@@ -284,7 +321,7 @@ void QtnPropertyDelegate::addSubItemBranchNode(
 			Qt::KeyboardModifiers mods = me ? me->modifiers() : Qt::NoModifier;
 			const bool alt = mods.testFlag(Qt::AltModifier);
 			const bool ctrl = mods.testFlag(Qt::ControlModifier) || mods.testFlag(Qt::MetaModifier);
-			const bool currentlyCollapsed = stateProperty()->isCollapsed();
+			const bool currentlyCollapsed = isBranchCollapsed(context.widget);
 			const bool targetCollapsed = !currentlyCollapsed;
 			if (alt && ctrl)
 			{
@@ -294,6 +331,10 @@ void QtnPropertyDelegate::addSubItemBranchNode(
 			{
 				if (context.widget)
 					context.widget->setBranchCollapsedRecursively(stateProperty(), targetCollapsed);
+			} else if (context.widget)
+			{
+				context.widget->setBranchCollapsed(
+					stateProperty(), targetCollapsed);
 			} else
 			{
 				stateProperty()->toggleState(QtnPropertyStateCollapsed);
@@ -304,9 +345,9 @@ void QtnPropertyDelegate::addSubItemBranchNode(
 		return false;
 	};
 
-	brItem.tooltipHandler = [this](QtnEventContext &,
+	brItem.tooltipHandler = [this](QtnEventContext &context,
 								const QtnSubItem &) -> QString {
-		return (stateProperty()->isCollapsed())
+		return isBranchCollapsed(context.widget)
 			? QtnPropertyView::tr("Click to expand")
 			: QtnPropertyView::tr("Click to collapse");
 	};
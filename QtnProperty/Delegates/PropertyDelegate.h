@@ -57,15 +57,24 @@ public:
 	// for complex properties like PropertyQFont
 	inline int subPropertyCount() const;
 	inline QtnPropertyBase *subProperty(int index);
+	// Lazy sub-properties are created on first request. View requests them
+	// only while the property is expanded and releases them on collapse.
+	inline bool hasLazySubProperties() const;
+	inline void releaseSubProperties();
 
 	// tune up with attributes
 	inline void applyAttributes(const QtnPropertyDelegateInfo &info);
 	// create GUI sub elements to present property on PropertyView
 	inline void createSubItems(
 		QtnDrawContext &context, QList<QtnSubItem> &subItems);
+	// height of property row, defaultHeight is the view item height
+	inline int rowHeight(int defaultHeight) const;
 
 	void addSubItemBranchNode(
 		QtnDrawContext &context, QList<QtnSubItem> &subItems);
+	// collapsed state of the branch in the view,
+	// state property tells it when view is null
+	bool isBranchCollapsed(const QtnPropertyView *view) const;
 
 	void applySubPropertyInfo(
 		const QtnPropertyDelegateInfo &info, const QtnSubPropertyInfo &subInfo);
@@ -74,6 +83,13 @@ public:
 
 	virtual bool isSplittable() const;
 
+	// Shareable delegate keeps no per-property state besides attributes,
+	// so one instance can serve all properties of the same type
+	// and delegate attributes. Such delegate is rebound with bindProperty
+	// before it is asked about a particular property.
+	virtual bool isShareable() const;
+	void bindProperty(QtnPropertyBase &owner);
+
 protected:
 	QtnPropertyDelegate(QtnPropertyBase &ownerProperty);
 
@@ -82,12 +98,16 @@ protected:
 
 	virtual int subPropertyCountImpl() const;
 	virtual QtnPropertyBase *subPropertyImpl(int index);
+	virtual bool hasLazySubPropertiesImpl() const;
+	virtual void releaseSubPropertiesImpl();
 
 	virtual void applyAttributesImpl(const QtnPropertyDelegateInfo &info);
 
 	virtual void createSubItemsImpl(
 		QtnDrawContext &context, QList<QtnSubItem> &subItems) = 0;
 
+	virtual int rowHeightImpl(int defaultHeight) const;
+
 	// helper functions
 	QStyle::State state(bool isActive, const QtnSubItem &subItem) const;
 
@@ -140,6 +160,16 @@ QtnPropertyBase *QtnPropertyDelegate::subProperty(int index)
 	return subPropertyImpl(index);
 }
 
+bool QtnPropertyDelegate::hasLazySubProperties() const
+{
+	return hasLazySubPropertiesImpl();
+}
+
+void QtnPropertyDelegate::releaseSubProperties()
+{
+	releaseSubPropertiesImpl();
+}
+
 void QtnPropertyDelegate::applyAttributes(const QtnPropertyDelegateInfo &info)
 {
 	applyAttributesImpl(info);
@@ -151,4 +181,9 @@ void QtnPropertyDelegate::createSubItems(
 	createSubItemsImpl(context, subItems);
 }
 
+int QtnPropertyDelegate::rowHeight(int defaultHeight) const
+{
+	return rowHeightImpl(defaultHeight);
+}
+
 #endif // QTN_PROPERTY_DELEGATE_H
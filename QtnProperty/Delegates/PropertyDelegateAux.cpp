@@ -16,6 +16,7 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyDelegateAux.h"
+#include "PropertyTextCache.h"
 #include "QtnProperty/PropertyView.h"
 #include "QtnProperty/MultiProperty.h"
 #include "QtnProperty/Utils/InplaceEditing.h"
@@ -205,7 +206,8 @@ bool QtnSubItem::event(QtnEventContext &context)
 				{
 					if (editable)
 					{
-						QObject::connect(editor, &QObject::destroyed,
+						QObject::connect(qtnInplaceEditSession(editor),
+							&QObject::destroyed,
 							[connections]() { connections->disconnect(); });
 					}
 					
@@ -315,6 +317,11 @@ QtnSubItemEvent::QtnSubItemEvent(Type type, QPoint mousePos)
 QString qtnElidedText(const QPainter &painter, const QString &text,
 	const QRect &rect, bool *elided)
 {
+	auto cache = QtnPropertyTextCache::current();
+	if (cache)
+		return cache->elidedText(
+			painter, text, rect.width(), Qt::ElideRight, elided);
+
 	QString newText =
 		painter.fontMetrics().elidedText(text, Qt::ElideRight, rect.width());
 
@@ -324,6 +331,20 @@ QString qtnElidedText(const QPainter &painter, const QString &text,
 	return newText;
 }
 
+void qtnDrawText(
+	QPainter &painter, const QString &text, const QRect &rect, int flags)
+{
+	auto cache = QtnPropertyTextCache::current();
+	if (cache)
+	{
+		cache->drawText(painter, rect, flags, text);
+		return;
+	}
+
+	painter.drawText(rect, flags | Qt::TextSingleLine,
+		qtnElidedText(painter, text, rect, nullptr));
+}
+
 void qtnDrawValueText(
 	const QString &text, QPainter &painter, const QRect &rect, QStyle *style)
 {
@@ -336,8 +357,18 @@ void qtnDrawValueText(
 		textRect.adjust(style->pixelMetric(QStyle::PM_ButtonMargin), 0, 0, 0);
 	}
 
-	painter.drawText(textRect, Qt::AlignLeading | Qt::AlignVCenter,
-		qtnElidedText(painter, text, textRect, nullptr));
+	qtnDrawText(painter, text, textRect);
+}
+
+QFont qtnBoldFont(const QFont &font)
+{
+	auto cache = QtnPropertyTextCache::current();
+	if (cache)
+		return cache->boldFont(font);
+
+	QFont result(font);
+	result.setBold(true);
+	return result;
 }
 
 QtnPropertyToEdit::QtnPropertyToEdit()
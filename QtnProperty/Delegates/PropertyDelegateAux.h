@@ -205,10 +205,15 @@ int QtnEventContext::eventType() const
 	return static_cast<int>(event->type());
 }
 
+// Text helpers use QtnPropertyTextCache of the view being painted
 QTN_IMPORT_EXPORT QString qtnElidedText(const QPainter &painter,
 	const QString &text, const QRect &rect, bool *elided = 0);
+// single line text elided to the width of rect
+QTN_IMPORT_EXPORT void qtnDrawText(QPainter &painter, const QString &text,
+	const QRect &rect, int flags = Qt::AlignLeading | Qt::AlignVCenter);
 QTN_IMPORT_EXPORT void qtnDrawValueText(const QString &text, QPainter &painter,
 	const QRect &rect, QStyle *style = nullptr);
+QTN_IMPORT_EXPORT QFont qtnBoldFont(const QFont &font);
 
 QTN_IMPORT_EXPORT std::function<QColor(const QPoint &, const QColor &, const QString &)> qtnResolveColorCallback(QObject *start);
 
@@ -48,44 +48,63 @@ limitations under the License.
 #include "QtnProperty/PropertyQVariant.h"
 
 #include <QDebug>
+#include <QAtomicInt>
+
+// incremented on any change of any factory
+static QAtomicInt qtnDelegateFactoryRevision;
+
+static QByteArray qtnDelegateName(const QtnPropertyBase &owner)
+{
+	auto delegateInfo = owner.delegateInfo();
+	if (delegateInfo)
+		return delegateInfo->name;
+
+	return QByteArray();
+}
 
 QtnPropertyDelegateFactory::QtnPropertyDelegateFactory(
 	QtnPropertyDelegateFactory *superFactory)
 	: m_superFactory(nullptr)
+	, m_createFunctionCacheRevision(-1)
 {
 	setSuperFactory(superFactory);
 }
 
+QtnPropertyDelegateFactory::~QtnPropertyDelegateFactory()
+{
+	// other factories may refer to create functions of this one
+	invalidateCreateFunctions();
+}
+
 void QtnPropertyDelegateFactory::setSuperFactory(
 	QtnPropertyDelegateFactory *superFactory)
 {
 	Q_ASSERT(m_superFactory != this);
 	m_superFactory = superFactory;
+	invalidateCreateFunctions();
 }
 
 QtnPropertyDelegate *QtnPropertyDelegateFactory::createDelegate(
 	QtnPropertyBase &owner)
 {
-	auto factory = this;
+	QByteArray delegateName = qtnDelegateName(owner);
 
-	while (factory)
-	{
-		auto result = factory->createDelegateInternal(owner);
-		if (result)
-		{
-			result->setFactory(this);
-			result->init();
-			return result;
-		}
+	auto createFunction = findCreateFunction(owner.metaObject(), delegateName);
+	auto result = createFunction ? (*createFunction)(owner) : nullptr;
 
-		factory = factory->m_superFactory;
+	// create function may reject the property, try others then
+	for (auto factory = this; !result && createFunction && factory;
+		 factory = factory->m_superFactory)
+	{
+		result = factory->createDelegateInternal(owner);
 	}
 
-	auto delegateInfo = owner.delegateInfo();
-	QByteArray delegateName;
-
-	if (delegateInfo)
-		delegateName = delegateInfo->name;
+	if (result)
+	{
+		result->setFactory(this);
+		result->init();
+		return result;
+	}
 
 	// create delegate stub
 	if (delegateName.isEmpty())
@@ -111,42 +130,78 @@ QtnPropertyDelegate *QtnPropertyDelegateFactory::createDelegate(
 QtnPropertyDelegate *QtnPropertyDelegateFactory::createDelegateInternal(
 	QtnPropertyBase &owner)
 {
-	const QMetaObject *metaObject = owner.metaObject();
+	auto createFunction =
+		findCreateFunctionInternal(owner.metaObject(), qtnDelegateName(owner));
+
+	if (!createFunction)
+		return nullptr;
+
+	return (*createFunction)(owner);
+}
+
+const QtnPropertyDelegateFactory::CreateFunction *
+QtnPropertyDelegateFactory::findCreateFunction(
+	const QMetaObject *metaObject, const QByteArray &delegateName)
+{
+	int revision = qtnDelegateFactoryRevision.loadAcquire();
+	if (m_createFunctionCacheRevision != revision)
+	{
+		m_createFunctionCache.clear();
+		m_createFunctionCacheRevision = revision;
+	}
+
+	CreateFunctionKey key(metaObject, delegateName);
+	auto it = m_createFunctionCache.constFind(key);
+	if (it != m_createFunctionCache.constEnd())
+		return it.value();
+
+	const CreateFunction *result = nullptr;
+	for (auto factory = this; !result && factory;
+		 factory = factory->m_superFactory)
+	{
+		result = factory->findCreateFunctionInternal(metaObject, delegateName);
+	}
 
-	CreateFunction createFunction = nullptr;
-	while (metaObject && !createFunction)
+	// create functions are not moved in memory until any factory is changed
+	m_createFunctionCache.insert(key, result);
+	return result;
+}
+
+const QtnPropertyDelegateFactory::CreateFunction *
+QtnPropertyDelegateFactory::findCreateFunctionInternal(
+	const QMetaObject *metaObject, const QByteArray &delegateName) const
+{
+	while (metaObject)
 	{
 		// try to find delegate factory by class name
-		auto it = m_createItems.find(metaObject);
+		auto it = m_createItems.constFind(metaObject);
 
-		if (it != m_createItems.end())
+		if (it != m_createItems.constEnd())
 		{
 			// try to find delegate factory by name
 			const CreateItem &createItem = it.value();
-			auto delegateInfo = owner.delegateInfo();
-			QByteArray delegateName;
-
-			if (delegateInfo)
-				delegateName = delegateInfo->name;
 
 			if (delegateName.isEmpty())
 			{
-				createFunction = createItem.defaultCreateFunction;
+				if (createItem.defaultCreateFunction)
+					return &createItem.defaultCreateFunction;
 			} else
 			{
-				auto jt = createItem.createFunctions.find(delegateName);
-				if (jt != createItem.createFunctions.end())
-					createFunction = jt.value();
+				auto jt = createItem.createFunctions.constFind(delegateName);
+				if (jt != createItem.createFunctions.constEnd())
+					return &jt.value();
 			}
 		}
 
 		metaObject = metaObject->superClass();
 	}
 
-	if (!createFunction)
-		return nullptr;
+	return nullptr;
+}
 
-	return createFunction(owner);
+void QtnPropertyDelegateFactory::invalidateCreateFunctions()
+{
+	qtnDelegateFactoryRevision.fetchAndAddRelease(1);
 }
 
 bool QtnPropertyDelegateFactory::registerDelegateDefault(
@@ -160,6 +215,7 @@ bool QtnPropertyDelegateFactory::registerDelegateDefault(
 	CreateItem &createItem = m_createItems[propertyMetaObject];
 	// register default create function
 	createItem.defaultCreateFunction = createFunction;
+	invalidateCreateFunctions();
 
 	if (!delegateName.isEmpty())
 	{
@@ -182,6 +238,7 @@ bool QtnPropertyDelegateFactory::registerDelegate(
 	CreateItem &createItem = m_createItems[propertyMetaObject];
 	// register create function
 	createItem.createFunctions[delegateName] = createFunction;
+	invalidateCreateFunctions();
 
 	return true;
 }
@@ -196,6 +253,7 @@ bool QtnPropertyDelegateFactory::unregisterDelegate(
 		return false;
 
 	m_createItems.erase(it);
+	invalidateCreateFunctions();
 	return true;
 }
 
@@ -215,6 +273,7 @@ bool QtnPropertyDelegateFactory::unregisterDelegate(
 		return false;
 
 	createFunctions.erase(it2);
+	invalidateCreateFunctions();
 	return true;
 }
 
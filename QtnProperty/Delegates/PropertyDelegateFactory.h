@@ -20,6 +20,8 @@ limitations under the License.
 
 #include "PropertyDelegate.h"
 #include <QMap>
+#include <QHash>
+#include <QPair>
 
 #include <functional>
 
@@ -33,6 +35,7 @@ public:
 
 	explicit QtnPropertyDelegateFactory(
 		QtnPropertyDelegateFactory *superFactory = nullptr);
+	~QtnPropertyDelegateFactory();
 
 	static void registerDefaultDelegates(QtnPropertyDelegateFactory &factory);
 
@@ -57,6 +60,14 @@ public:
 private:
 	QtnPropertyDelegate *createDelegateInternal(QtnPropertyBase &owner);
 
+	// looks through this factory and its super factories,
+	// result is cached until any factory is changed
+	const CreateFunction *findCreateFunction(
+		const QMetaObject *metaObject, const QByteArray &delegateName);
+	const CreateFunction *findCreateFunctionInternal(
+		const QMetaObject *metaObject, const QByteArray &delegateName) const;
+	static void invalidateCreateFunctions();
+
 	QtnPropertyDelegateFactory *m_superFactory;
 
 	struct CreateItem
@@ -66,6 +77,10 @@ private:
 	};
 
 	QMap<const QMetaObject *, CreateItem> m_createItems;
+
+	using CreateFunctionKey = QPair<const QMetaObject *, QByteArray>;
+	QHash<CreateFunctionKey, const CreateFunction *> m_createFunctionCache;
+	int m_createFunctionCacheRevision;
 };
 
 QtnPropertyDelegateFactory *QtnPropertyDelegateFactory::superFactory()
@@ -0,0 +1,176 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#include "PropertyTextCache.h"
+
+#include <QPainter>
+#include <QFontMetrics>
+#include <QStyle>
+
+static thread_local QtnPropertyTextCache *qtnCurrentTextCache = nullptr;
+
+QtnPropertyTextCache::QtnPropertyTextCache(int capacity)
+	: m_devicePixelRatio(1.0)
+	, m_capacity(qMax(1, capacity))
+	, m_boldValid(false)
+{
+}
+
+QtnPropertyTextCache *QtnPropertyTextCache::current()
+{
+	return qtnCurrentTextCache;
+}
+
+QtnPropertyTextCache::Scope::Scope(QtnPropertyTextCache *cache)
+	: m_previous(qtnCurrentTextCache)
+{
+	qtnCurrentTextCache = cache;
+}
+
+QtnPropertyTextCache::Scope::~Scope()
+{
+	qtnCurrentTextCache = m_previous;
+}
+
+QString QtnPropertyTextCache::elidedText(const QPainter &painter,
+	const QString &text, int width, Qt::TextElideMode mode, bool *elided)
+{
+	auto &e = entry(painter, text, width, mode);
+
+	if (elided)
+		*elided = e.elided;
+
+	return e.elidedText;
+}
+
+void QtnPropertyTextCache::drawText(QPainter &painter, const QRect &rect,
+	int flags, const QString &text, Qt::TextElideMode mode)
+{
+	if (text.isEmpty() || rect.width() <= 0)
+		return;
+
+	auto &e = entry(painter, text, rect.width(), mode);
+
+	if (e.elidedText.isEmpty())
+		return;
+
+	if (!e.prepared)
+	{
+		e.staticText.setTextFormat(Qt::PlainText);
+		e.staticText.setText(e.elidedText);
+		e.staticText.prepare(QTransform(), painter.font());
+		e.prepared = true;
+	}
+
+	auto size = e.staticText.size();
+	auto alignment = QStyle::visualAlignment(
+		painter.layoutDirection(), Qt::Alignment(flags));
+
+	qreal x = rect.left();
+	if (alignment & Qt::AlignRight)
+		x = rect.left() + rect.width() - size.width();
+	else if (alignment & Qt::AlignHCenter)
+		x = rect.left() + (rect.width() - size.width()) / 2;
+
+	qreal y = rect.top();
+	if (alignment & Qt::AlignBottom)
+		y = rect.top() + rect.height() - size.height();
+	else if (alignment & Qt::AlignVCenter)
+		y = rect.top() + (rect.height() - size.height()) / 2;
+
+	QPointF position(qRound(x), qRound(y));
+
+	// same clipping as QPainter::drawText does
+	bool clip = size.height() > rect.height();
+	if (clip)
+	{
+		painter.save();
+		painter.setClipRect(rect, Qt::IntersectClip);
+	}
+
+	painter.drawStaticText(position, e.staticText);
+
+	if (clip)
+		painter.restore();
+}
+
+const QFont &QtnPropertyTextCache::boldFont(const QFont &font)
+{
+	if (!m_boldValid || m_boldBase != font)
+	{
+		m_boldBase = font;
+		m_bold = font;
+		m_bold.setBold(true);
+		m_boldValid = true;
+	}
+
+	return m_bold;
+}
+
+void QtnPropertyTextCache::setDevicePixelRatio(qreal ratio)
+{
+	if (!qFuzzyCompare(m_devicePixelRatio, ratio))
+	{
+		clear();
+		m_devicePixelRatio = ratio;
+	}
+}
+
+void QtnPropertyTextCache::clear()
+{
+	m_entries.clear();
+	m_previous.clear();
+	m_boldValid = false;
+}
+
+int QtnPropertyTextCache::count() const
+{
+	return m_entries.size() + m_previous.size();
+}
+
+QtnPropertyTextCache::Entry &QtnPropertyTextCache::entry(
+	const QPainter &painter, const QString &text, int width,
+	Qt::TextElideMode mode)
+{
+	Key key { text, painter.font(), width, int(mode) };
+
+	auto it = m_entries.find(key);
+	if (it != m_entries.end())
+		return it.value();
+
+	Entry e;
+	auto previous = m_previous.find(key);
+	if (previous != m_previous.end())
+	{
+		e = previous.value();
+	} else
+	{
+		QFontMetrics fm(key.font, painter.device());
+		e.elidedText = fm.elidedText(text, mode, width);
+		e.elided = (e.elidedText != text);
+		e.prepared = false;
+	}
+
+	// least recently used entries are dropped with the older generation
+	if (m_entries.size() >= m_capacity)
+	{
+		m_previous.swap(m_entries);
+		m_entries.clear();
+	}
+
+	return m_entries.insert(key, e).value();
+}
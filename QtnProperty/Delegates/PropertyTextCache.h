@@ -0,0 +1,117 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+
+#include <QFont>
+#include <QHash>
+#include <QStaticText>
+#include <QString>
+
+class QPainter;
+class QRect;
+
+// Elided strings and prepared QStaticText of single line texts drawn
+// by delegates. QtnPropertyView owns a cache and makes it current while
+// painting, so qtnElidedText, qtnDrawText and qtnDrawValueText use it.
+// Entries are keyed by text, font, width and elide mode.
+class QTN_IMPORT_EXPORT QtnPropertyTextCache
+{
+	Q_DISABLE_COPY(QtnPropertyTextCache)
+
+public:
+	enum
+	{
+		// entries kept in each of two generations
+		DefaultCapacity = 2048
+	};
+
+	explicit QtnPropertyTextCache(int capacity = DefaultCapacity);
+
+	// cache of the view being painted in current thread, or nullptr
+	static QtnPropertyTextCache *current();
+
+	class QTN_IMPORT_EXPORT Scope
+	{
+		Q_DISABLE_COPY(Scope)
+
+	public:
+		explicit Scope(QtnPropertyTextCache *cache);
+		~Scope();
+
+	private:
+		QtnPropertyTextCache *m_previous;
+	};
+
+	QString elidedText(const QPainter &painter, const QString &text,
+		int width, Qt::TextElideMode mode = Qt::ElideRight,
+		bool *elided = nullptr);
+
+	// single line text elided to the width of rect
+	void drawText(QPainter &painter, const QRect &rect, int flags,
+		const QString &text, Qt::TextElideMode mode = Qt::ElideRight);
+
+	const QFont &boldFont(const QFont &font);
+
+	// clears the cache if ratio differs from the previous one
+	void setDevicePixelRatio(qreal ratio);
+	void clear();
+
+	int count() const;
+
+private:
+	struct Key
+	{
+		QString text;
+		QFont font;
+		int width;
+		int elideMode;
+
+		inline bool operator==(const Key &other) const
+		{
+			return width == other.width && elideMode == other.elideMode &&
+				text == other.text && font == other.font;
+		}
+
+		friend inline uint qHash(const Key &key, uint seed = 0)
+		{
+			return qHash(key.text, seed) ^ qHash(key.font, seed) ^
+				uint(key.width) ^ (uint(key.elideMode) << 24);
+		}
+	};
+
+	struct Entry
+	{
+		QString elidedText;
+		QStaticText staticText;
+		bool elided;
+		bool prepared;
+	};
+
+	Entry &entry(const QPainter &painter, const QString &text, int width,
+		Qt::TextElideMode mode);
+
+	QHash<Key, Entry> m_entries;
+	QHash<Key, Entry> m_previous;
+	QFont m_boldBase;
+	QFont m_bold;
+	qreal m_devicePixelRatio;
+	int m_capacity;
+	bool m_boldValid;
+};
@@ -225,9 +225,7 @@ void QtnPropertyDelegateWithValues::addSubItemName(
 
 		if (!stateProperty()->valueIsDefault())
 		{
-			auto font = context.painter->font();
-			font.setBold(true);
-			context.painter->setFont(font);
+			context.painter->setFont(qtnBoldFont(context.painter->font()));
 		}
 
 		QRect textRect = item.rect;
@@ -242,10 +240,7 @@ void QtnPropertyDelegateWithValues::addSubItemName(
 			textRect.setLeft(textRect.left() + iconHeight + 6);
 		}
 
-		context.painter->drawText(textRect,
-			int(Qt::AlignLeading | Qt::AlignVCenter) | Qt::TextSingleLine,
-			qtnElidedText(
-				*context.painter, property()->displayName(), textRect));
+		qtnDrawText(*context.painter, property()->displayName(), textRect);
 
 		context.painter->restore();
 	};
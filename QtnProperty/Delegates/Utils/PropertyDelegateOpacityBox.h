@@ -18,6 +18,7 @@ limitations under the License.
 #pragma once
 
 #include "PropertyDelegateSliderBox.h"
+#include "QtnProperty/Utils/QtnSwatchCache.h"
 
 #include <QPainterPath>
 #include <QApplication>
@@ -99,20 +100,10 @@ protected:
 		// Background (checkerboard or solid color)
 		if (m_useCheckerBackground && !boxRect.isEmpty())
 		{
-			QImage img(boxRect.size(), QImage::Format_ARGB32_Premultiplied);
 			// two grays like typical transparency pattern, adapted for dark mode
 			QColor c1 = isDark ? QColor("#1e1e1e") : QColor("#fafafa");
 			QColor c2 = isDark ? QColor("#323334") : QColor("#f4f4f4");
-			for (int y = 0; y < img.height(); ++y)
-			{
-				QRgb *scan = reinterpret_cast<QRgb *>(img.scanLine(y));
-				for (int x = 0; x < img.width(); ++x)
-				{
-					bool alt = (((x >> 3) ^ (y >> 3)) & 0x1) != 0;
-					scan[x] = (alt ? c2 : c1).rgb();
-				}
-			}
-			painter.drawImage(boxRect.topLeft(), img);
+			QtnSwatchCache::drawChecker(painter, boxRect, c1, c2);
 		} else
 		{
 			QColor bg = m_backgroundColor.isValid()
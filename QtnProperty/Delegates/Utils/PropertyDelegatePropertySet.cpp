@@ -86,19 +86,13 @@ void QtnPropertyDelegatePropertySet::createSubItemsImpl(
 				QPen oldPen = context.painter->pen();
 
 				// draw name
-				QFont font = oldFont;
-				font.setBold(true);
-				context.painter->setFont(font);
+				context.painter->setFont(qtnBoldFont(oldFont));
 
 				context.painter->setPen(
 					context.textColorFor(stateProperty()->isEditableByUser()));
 
-				QString elidedName = context.painter->fontMetrics().elidedText(
-					property()->displayName(), Qt::ElideRight,
-					item.rect.width());
-				context.painter->drawText(item.rect,
-					Qt::AlignLeading | Qt::AlignVCenter | Qt::TextSingleLine,
-					elidedName);
+				qtnDrawText(
+					*context.painter, property()->displayName(), item.rect);
 
 				context.painter->setPen(oldPen);
 				context.painter->setFont(oldFont);
@@ -21,9 +21,9 @@ limitations under the License.
 #include "QtnProperty/Auxiliary/PropertyMacro.h"
 #include "QtnProperty/PropertyDelegateAttrs.h"
 #include "QtnProperty/MultiProperty.h"
+#include "QtnProperty/Utils/QtnConnections.h"
 
 #include <QMouseEvent>
-#include <QVariantAnimation>
 
 QByteArray qtnFillColorAttr()
 {
@@ -73,30 +73,31 @@ QtnPropertyDelegateSlideBox::QtnPropertyDelegateSlideBox(QtnPropertyBase &owner)
 	, m_drawText(true)
 	, m_dragValuePart(0.0)
 	, m_oldValuePart(0.0)
-	, m_animateWidget(nullptr)
+	, m_animateProperty(nullptr)
+	, m_pendingSteps(0)
 {
 }
 
 QtnPropertyDelegateSlideBox::~QtnPropertyDelegateSlideBox()
 {
-	m_animation.reset();
+	stopAnimate();
 }
 
 void QtnPropertyDelegateSlideBox::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
-	info.loadAttribute(qtnFillColorAttr(), m_boxFillColor);
-	info.loadAttribute(qtnLiveUpdateAttr(), m_liveUpdate);
-	info.loadAttribute(qtnDrawBorderAttr(), m_drawBorder);
-	info.loadAttribute(qtnUpdateByScrollAttr(), m_updateByScroll);
-	info.loadAttribute(qtnAnimateAttr(), m_animate);
-	info.loadAttribute(qtnToolTipAttr(), m_itemToolTip);
-	info.loadAttribute(qtnDrawTextAttr(), m_drawText);
-	info.loadAttribute(qtnSuffixAttr(), m_suffix);
-	info.loadAttribute(qtnPrecisionAttr(), m_precision);
-	info.loadAttribute(qtnMultiplierAttr(), m_multiplier);
-	m_min = info.attributes.value(qtnMinAttr());
-	m_max = info.attributes.value(qtnMaxAttr());
+	info.loadAttribute(QtnFillColorAttrId, m_boxFillColor);
+	info.loadAttribute(QtnLiveUpdateAttrId, m_liveUpdate);
+	info.loadAttribute(QtnDrawBorderAttrId, m_drawBorder);
+	info.loadAttribute(QtnUpdateByScrollAttrId, m_updateByScroll);
+	info.loadAttribute(QtnAnimateAttrId, m_animate);
+	info.loadAttribute(QtnToolTipAttrId, m_itemToolTip);
+	info.loadAttribute(QtnDrawTextAttrId, m_drawText);
+	info.loadAttribute(QtnSuffixAttrId, m_suffix);
+	info.loadAttribute(QtnPrecisionAttrId, m_precision);
+	info.loadAttribute(QtnMultiplierAttrId, m_multiplier);
+	m_min = info.attributeValue(QtnMinAttrId);
+	m_max = info.attributeValue(QtnMaxAttrId);
 
 	m_precision = qBound(0, m_precision, std::numeric_limits<double>::digits10);
 	if (!qIsFinite(m_multiplier) || qFuzzyCompare(m_multiplier, 0.0))
@@ -117,9 +118,18 @@ bool QtnPropertyDelegateSlideBox::createSubItemValueImpl(
 
 	if (m_animate)
 	{
-		m_dragValuePart = propertyValuePart();
-		m_animation.reset(new QVariantAnimation());
-		m_animateWidget = context.widget->viewport();
+		// sub-items are recreated whenever the view invalidates them,
+		// so animation is stopped only when it is not the same row anymore
+		auto clock = QtnAnimationClock::forWidget(context.widget->viewport());
+		if (clock != m_animationClock || property() != m_animateProperty ||
+			subItemValue.rect != m_animateRect)
+		{
+			stopAnimate();
+			m_dragValuePart = propertyValuePart();
+			m_animationClock = clock;
+			m_animateProperty = property();
+			m_animateRect = subItemValue.rect;
+		}
 	}
 
 	return true;
@@ -135,9 +145,12 @@ void QtnPropertyDelegateSlideBox::draw(
 		return;
 	}
 
+	// row may move while animating
+	if (m_animate)
+		m_animateRect = item.rect;
+
 	double valuePart = m_dragValuePart =
-		(item.state() == QtnSubItemStatePushed ||
-			(m_animate && m_animation->state() == QVariantAnimation::Running))
+		(item.state() == QtnSubItemStatePushed || isAnimating())
 			? dragValuePart()
 			: propertyValuePart();
 	if (valuePart < 0.0)
@@ -193,10 +206,7 @@ bool QtnPropertyDelegateSlideBox::event(
 			else
 				return false;
 
-			toEdit->setup(property(), [this, increment]() -> QWidget * {
-				incrementPropertyValueInternal(increment);
-				return nullptr;
-			});
+			postIncrement(context.widget, increment);
 			return true;
 		}
 
@@ -206,10 +216,7 @@ bool QtnPropertyDelegateSlideBox::event(
 			{
 				int steps =
 					context.eventAs<QWheelEvent>()->angleDelta().y() / 120;
-				toEdit->setup(property(), [this, steps]() -> QWidget * {
-					incrementPropertyValueInternal(steps);
-					return nullptr;
-				});
+				postIncrement(context.widget, steps);
 				return true;
 			}
 
@@ -241,14 +248,10 @@ bool QtnPropertyDelegateSlideBox::event(
 					context.eventAs<QMouseEvent>()->x(), item.rect);
 				if (m_liveUpdate)
 				{
-					if (m_animate)
-						m_animation->stop();
+					stopAnimate();
 					m_dragValuePart = dragValuePart;
-					toEdit->setup(
-						property(), [this, dragValuePart]() -> QWidget * {
-							setPropertyValuePart(dragValuePart);
-							return nullptr;
-						});
+					postValuePart(context.widget, dragValuePart);
+					context.updateWidget();
 				} else if (!m_animate)
 				{
 					m_dragValuePart = dragValuePart;
@@ -262,6 +265,10 @@ bool QtnPropertyDelegateSlideBox::event(
 		case QtnSubItemEvent::ReleaseMouse:
 		{
 			context.widget->setCursor(m_oldCursor);
+			// exact final value replaces coalesced live updates
+			m_liveUpdates.cancel();
+			m_pendingSteps = 0;
+			m_animateRect = item.rect;
 			auto dragValuePart = toDragValuePart(
 				context.eventAs<QtnSubItemEvent>()->x(), item.rect);
 			toEdit->setup(property(), [this, dragValuePart]() -> QWidget * {
@@ -279,12 +286,48 @@ bool QtnPropertyDelegateSlideBox::event(
 
 void QtnPropertyDelegateSlideBox::incrementPropertyValueInternal(int steps)
 {
-	if (m_animate)
-		m_animation->stop();
+	stopAnimate();
 	incrementPropertyValue(steps);
 	m_dragValuePart = propertyValuePart();
 }
 
+void QtnPropertyDelegateSlideBox::postIncrement(
+	QtnPropertyView *view, int steps)
+{
+	m_pendingSteps += steps;
+	editLive(view, [this]() {
+		int steps = m_pendingSteps;
+		m_pendingSteps = 0;
+		if (steps != 0)
+			incrementPropertyValueInternal(steps);
+	});
+}
+
+void QtnPropertyDelegateSlideBox::postValuePart(
+	QtnPropertyView *view, double valuePart)
+{
+	m_pendingSteps = 0;
+	editLive(view, [this, valuePart]() { setPropertyValuePart(valuePart); });
+}
+
+void QtnPropertyDelegateSlideBox::editLive(
+	QtnPropertyView *view, const std::function<void()> &edit)
+{
+	m_liveUpdateView = view;
+	m_liveUpdates.post([this, edit]() {
+		auto editProperty = property();
+		if (!editProperty->isEditableByUser())
+			return;
+
+		// coalesced edit may be applied outside of event handling,
+		// so it is connected to the view the same way as QtnPropertyToEdit
+		QtnConnections connections;
+		if (m_liveUpdateView)
+			m_liveUpdateView->connectPropertyToEdit(editProperty, connections);
+		edit();
+	});
+}
+
 double QtnPropertyDelegateSlideBox::toDragValuePart(int x, const QRect &rect)
 {
 	const int boxWidth = 120;
@@ -311,10 +354,10 @@ void QtnPropertyDelegateSlideBox::dragTo(double value)
 
 void QtnPropertyDelegateSlideBox::prepareAnimate()
 {
-	if (m_animation->state() == QVariantAnimation::Running)
+	if (isAnimating())
 	{
 		m_oldValuePart = m_dragValuePart;
-		m_animation->stop();
+		stopAnimate();
 	} else
 	{
 		m_oldValuePart = m_dragValuePart = propertyValuePart();
@@ -325,20 +368,27 @@ void QtnPropertyDelegateSlideBox::startAnimate()
 {
 	double startValue = m_oldValuePart;
 	double endValue = propertyValuePart();
-	if (endValue == startValue)
+	if (endValue == startValue || !m_animationClock)
 		return;
-	m_animation->setStartValue(startValue);
-	m_animation->setEndValue(endValue);
-	m_animation->setDuration(300);
-	m_animation->setEasingCurve(QEasingCurve::OutCirc);
-	QObject::connect(m_animation.data(), &QVariantAnimation::valueChanged,
+
+	m_animationClock->start(this, startValue, endValue, 300,
+		QEasingCurve::OutCirc,
 		qtnMemFn(this, &QtnPropertyDelegateSlideBox::onAnimationChanged));
-	m_animation->start();
 }
 
-void QtnPropertyDelegateSlideBox::onAnimationChanged(const QVariant &value)
+bool QtnPropertyDelegateSlideBox::isAnimating() const
+{
+	return m_animationClock && m_animationClock->isRunning(this);
+}
+
+void QtnPropertyDelegateSlideBox::stopAnimate()
+{
+	if (m_animationClock)
+		m_animationClock->stop(this);
+}
+
+QRect QtnPropertyDelegateSlideBox::onAnimationChanged(double value)
 {
-	m_dragValuePart = value.toDouble();
-	if (m_animateWidget)
-		m_animateWidget->update();
+	m_dragValuePart = value;
+	return m_animateRect;
 }
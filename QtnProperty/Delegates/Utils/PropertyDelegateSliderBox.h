@@ -22,8 +22,12 @@ limitations under the License.
 #include "Delegates/PropertyDelegateAux.h"
 #include "PropertyDelegateAttrs.h"
 #include "Utils/DoubleSpinBox.h"
+#include "Utils/QtnUpdateCoalescer.h"
+#include "Utils/QtnAnimationClock.h"
 
-class QVariantAnimation;
+#include <QPointer>
+
+class QtnPropertyView;
 
 class QTN_IMPORT_EXPORT QtnPropertyDelegateSlideBox
 	: public QtnPropertyDelegateWithValue
@@ -51,6 +55,8 @@ protected:
 
 	void prepareAnimate();
 	void startAnimate();
+	bool isAnimating() const;
+	void stopAnimate();
 
 	bool m_liveUpdate;
 	bool m_drawBorder;
@@ -67,16 +73,27 @@ protected:
 
 private:
 	void incrementPropertyValueInternal(int steps);
+	void postIncrement(QtnPropertyView *view, int steps);
+	void postValuePart(QtnPropertyView *view, double valuePart);
+	void editLive(
+		QtnPropertyView *view, const std::function<void()> &edit);
 	double toDragValuePart(int x, const QRect &rect);
 	void dragTo(double value);
-	void onAnimationChanged(const QVariant &value);
+	QRect onAnimationChanged(double value);
 
 	double m_dragValuePart;
 	double m_oldValuePart;
 
-	QWidget *m_animateWidget;
+	// animations of all slide boxes of a view share one clock
+	QPointer<QtnAnimationClock> m_animationClock;
+	const QtnPropertyBase *m_animateProperty;
+	QRect m_animateRect;
 	QCursor m_oldCursor;
-	QScopedPointer<QVariantAnimation> m_animation;
+
+	// drag, wheel and key repeat edits limited to display rate
+	QtnUpdateCoalescer m_liveUpdates;
+	QPointer<QtnPropertyView> m_liveUpdateView;
+	int m_pendingSteps;
 };
 
 double QtnPropertyDelegateSlideBox::dragValuePart() const
@@ -0,0 +1,138 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#include "PropertyDialogSession.h"
+#include "QtnProperty/PropertyBase.h"
+#include "QtnProperty/PropertyView.h"
+
+#include <QDialog>
+#include <QHash>
+
+namespace
+{
+using OpenSessions =
+	QHash<const QtnPropertyBase *, QtnPropertyDialogSession *>;
+
+// used from GUI thread only
+OpenSessions &openSessions()
+{
+	static OpenSessions sessions;
+	return sessions;
+}
+
+void showDialog(QDialog *dialog)
+{
+	dialog->show();
+	dialog->raise();
+	dialog->activateWindow();
+}
+} // namespace
+
+QtnPropertyDialogSession *QtnPropertyDialogSession::open(QDialog *dialog,
+	QtnPropertyBase *property, QtnPropertyChangeReason editReason,
+	QWidget *context, const CommitHandler &onCommit)
+{
+	Q_ASSERT(dialog);
+	Q_ASSERT(property);
+	Q_ASSERT(!openSessions().contains(property));
+
+	QtnPropertyView *view = nullptr;
+	for (QObject *p = context; p && !view; p = p->parent())
+		view = qobject_cast<QtnPropertyView *>(p);
+
+	QWidget *window = context ? context->window() : nullptr;
+	if (view && window == view)
+	{
+		// view must not delete the session while being destroyed
+		window = nullptr;
+		QObject::connect(
+			view, &QObject::destroyed, dialog, &QObject::deleteLater);
+	}
+
+	dialog->setParent(window, dialog->windowFlags() | Qt::Dialog);
+	dialog->setModal(false);
+
+	auto session = new QtnPropertyDialogSession(
+		dialog, property, editReason, view, onCommit);
+
+	showDialog(dialog);
+	return session;
+}
+
+bool QtnPropertyDialogSession::activate(const QtnPropertyBase *property)
+{
+	auto session = openSessions().value(property);
+	if (!session)
+		return false;
+
+	showDialog(session->m_dialog);
+	return true;
+}
+
+QtnPropertyDialogSession::QtnPropertyDialogSession(QDialog *dialog,
+	QtnPropertyBase *property, QtnPropertyChangeReason editReason,
+	QtnPropertyView *view, const CommitHandler &onCommit)
+	: QObject(dialog)
+	, m_dialog(dialog)
+	, m_property(property)
+	, m_registeredProperty(property)
+	, m_lockedProperty(property)
+	, m_view(view)
+	, m_editReason(editReason)
+	, m_onCommit(onCommit)
+{
+	openSessions().insert(property, this);
+
+	if (m_view)
+		m_view->lockStructure(m_lockedProperty);
+
+	// rejected dialog applies nothing
+	QObject::connect(dialog, &QDialog::accepted, this,
+		&QtnPropertyDialogSession::commit);
+	QObject::connect(dialog, &QDialog::finished, this, [this]() {
+		unregister();
+		m_dialog->deleteLater();
+	});
+	QObject::connect(property, &QObject::destroyed, this, [this]() {
+		unregister();
+		m_dialog->reject();
+	});
+}
+
+QtnPropertyDialogSession::~QtnPropertyDialogSession()
+{
+	unregister();
+
+	// deferred rebuild of the view happens here
+	if (m_view)
+		m_view->unlockStructure(m_lockedProperty);
+}
+
+void QtnPropertyDialogSession::commit()
+{
+	if (m_property && m_onCommit)
+		m_onCommit(m_editReason);
+}
+
+void QtnPropertyDialogSession::unregister()
+{
+	if (m_registeredProperty)
+	{
+		openSessions().remove(m_registeredProperty);
+		m_registeredProperty = nullptr;
+	}
+}
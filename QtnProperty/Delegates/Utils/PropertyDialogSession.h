@@ -0,0 +1,87 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+#include "QtnProperty/Auxiliary/PropertyAux.h"
+
+#include <QObject>
+#include <QPointer>
+
+#include <functional>
+
+class QDialog;
+class QWidget;
+class QtnPropertyBase;
+class QtnPropertyView;
+
+// Edits a property with a non-modal dialog instead of a nested event loop.
+// Accepted dialog commits the edit with the commit handler,
+// rejected one cancels it. Property view owning the editor keeps its
+// structure locked while the dialog is open
+// (see QtnPropertyView::lockStructure).
+// The session is deleted together with the dialog after it is finished.
+class QTN_IMPORT_EXPORT QtnPropertyDialogSession : public QObject
+{
+	Q_DISABLE_COPY(QtnPropertyDialogSession)
+
+public:
+	// called only while the property is alive
+	using CommitHandler = std::function<void(QtnPropertyChangeReason reason)>;
+
+	// Takes ownership of the dialog and shows it. Dialog is reparented
+	// to the window of context widget, because inplace editor
+	// may be deleted while the dialog is open.
+	static QtnPropertyDialogSession *open(QDialog *dialog,
+		QtnPropertyBase *property, QtnPropertyChangeReason editReason,
+		QWidget *context, const CommitHandler &onCommit);
+
+	// raises the dialog of an open session,
+	// returns false if there is no session for the property
+	static bool activate(const QtnPropertyBase *property);
+
+	inline QDialog *dialog() const;
+	inline QtnPropertyBase *property() const;
+
+private:
+	QtnPropertyDialogSession(QDialog *dialog, QtnPropertyBase *property,
+		QtnPropertyChangeReason editReason, QtnPropertyView *view,
+		const CommitHandler &onCommit);
+	virtual ~QtnPropertyDialogSession() override;
+
+	void commit();
+	void unregister();
+
+	QDialog *m_dialog;
+	QPointer<QtnPropertyBase> m_property;
+	const QtnPropertyBase *m_registeredProperty;
+	const QtnPropertyBase *m_lockedProperty;
+	QPointer<QtnPropertyView> m_view;
+	QtnPropertyChangeReason m_editReason;
+	CommitHandler m_onCommit;
+};
+
+QDialog *QtnPropertyDialogSession::dialog() const
+{
+	return m_dialog;
+}
+
+QtnPropertyBase *QtnPropertyDialogSession::property() const
+{
+	return m_property;
+}
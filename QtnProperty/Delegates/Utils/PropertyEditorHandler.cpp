@@ -25,7 +25,7 @@ limitations under the License.
 
 QtnPropertyEditorHandlerBase::QtnPropertyEditorHandlerBase(
 	QtnPropertyDelegate *delegate, QWidget &editor)
-	: QObject(&editor)
+	: QObject(qtnInplaceEditSession(&editor))
 	, reverted(false)
 	, returned(false)
 	, m_delegate(delegate)
@@ -61,12 +61,18 @@ void QtnPropertyEditorHandlerBase::cleanup()
 {
 	if (m_delegate)
 	{
-		m_delegate->m_editorHandler = nullptr;
+		if (m_delegate->m_editorHandler == this)
+			m_delegate->m_editorHandler = nullptr;
 		m_delegate = nullptr;
 	}
 	if (m_editor)
+	{
 		m_editor->removeEventFilter(this);
-	qtnStopInplaceEdit();
+
+		// pooled editor may be already bound to another edit
+		if (qtnInplaceEditSession(m_editor) == parent())
+			qtnStopInplaceEdit();
+	}
 }
 
 QtnPropertyEditorHandlerBase::~QtnPropertyEditorHandlerBase()
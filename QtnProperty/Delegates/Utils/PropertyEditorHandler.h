@@ -21,6 +21,7 @@ limitations under the License.
 #include "QtnProperty/Config.h"
 #include "QtnProperty/Property.h"
 #include "QtnProperty/Delegates/PropertyDelegate.h"
+#include "QtnProperty/Utils/QtnUpdateCoalescer.h"
 
 #include <QWidget>
 #include <QEvent>
@@ -142,16 +143,38 @@ protected:
 		QtnPropertyDelegate *delegate, PropertyEditorClass &editor)
 		: Inherited(delegate, editor)
 		, updating(0)
+		, coalesceUpdates(false)
 	{
 		newValue = this->property().value();
 	}
 
+	// handlers overriding updateValue should flush in own destructor
+	virtual ~QtnPropertyEditorHandlerVT() override
+	{
+		flushValue();
+	}
+
 	void onValueChanged(ValueType value)
 	{
 		if (updating > 0)
 			return;
 		newValue = value;
-		updateValue();
+		if (coalesceUpdates)
+			valueUpdates.post([this]() { updateValue(); });
+		else
+			updateValue();
+	}
+
+	// applies value delayed by coalescing
+	void flushValue()
+	{
+		valueUpdates.flush();
+	}
+
+	virtual void revertInput() override
+	{
+		valueUpdates.cancel();
+		Inherited::revertInput();
 	}
 
 	virtual void updateValue()
@@ -162,6 +185,11 @@ protected:
 
 	ValueTypeStore newValue;
 	unsigned updating;
+	// limit rate of updates from key repeat and wheel
+	bool coalesceUpdates;
+
+private:
+	QtnUpdateCoalescer valueUpdates;
 };
 
 template <typename PropertyClass, typename PropertyEditorClass>
@@ -20,6 +20,29 @@ limitations under the License.
 #include <QRegExp>
 #include <QStringList>
 #include <QCoreApplication>
+#include <QHash>
+#include <QMutex>
+#include <QVarLengthArray>
+#include <QtAlgorithms>
+
+#include <algorithm>
+
+enum
+{
+	QtnEnumFlagBitCount = 32,
+	QtnMaxEnumFlagsStrCacheSize = 256
+};
+
+struct QtnEnumInfo::LookupTable
+{
+	// indexes of values having the bit
+	QVarLengthArray<int, 1> bitValues[QtnEnumFlagBitCount];
+	// case folded for case insensitive enums
+	QHash<QString, int> nameIndex;
+
+	QMutex strCacheMutex;
+	QHash<QtnEnumValueType, QString> strCache;
+};
 
 QtnEnumInfo::QtnEnumInfo()
 	: m_case_sensitivity(Qt::CaseInsensitive)
@@ -88,20 +111,13 @@ const QtnEnumValueInfo *QtnEnumInfo::findByValue(QtnEnumValueType value) const
 
 const QtnEnumValueInfo *QtnEnumInfo::findByName(const QString &name) const
 {
-	const QtnEnumValueInfo *result = nullptr;
+	auto table = lookupTable();
+	auto it = table->nameIndex.constFind(
+		m_case_sensitivity == Qt::CaseSensitive ? name : name.toCaseFolded());
+	if (it == table->nameIndex.constEnd())
+		return nullptr;
 
-	forEachEnumValue([&result, &name, this](
-						 const QtnEnumValueInfo &enumValue) -> bool {
-		if (QString::compare(enumValue.name(), name, m_case_sensitivity) == 0)
-		{
-			result = &enumValue;
-			return false;
-		}
-
-		return true;
-	});
-
-	return result;
+	return &m_values.at(it.value());
 }
 
 const QtnEnumValueInfo *QtnEnumInfo::findByDisplayName(
@@ -170,6 +186,103 @@ bool QtnEnumInfo::toStr(QString &str, QtnEnumValueType value) const
 	return toStr(str, findByValue(value));
 }
 
+void QtnEnumInfo::collectFlagValues(
+	QtnEnumValueType flags, QVector<const QtnEnumValueInfo *> &values) const
+{
+	values.clear();
+	if (flags == 0)
+		return;
+
+	auto table = lookupTable();
+	QVarLengthArray<int, QtnEnumFlagBitCount> indexes;
+	for (quint32 bits = quint32(flags); bits != 0; bits &= bits - 1)
+	{
+		auto &bitValues = table->bitValues[qCountTrailingZeroBits(bits)];
+		indexes.append(bitValues.constData(), bitValues.size());
+	}
+
+	std::sort(indexes.begin(), indexes.end());
+	auto end = std::unique(indexes.begin(), indexes.end());
+
+	values.reserve(int(end - indexes.begin()));
+	for (auto it = indexes.begin(); it != end; ++it)
+		values.append(&m_values.at(*it));
+}
+
+QString QtnEnumInfo::flagsToStr(QtnEnumValueType flags) const
+{
+	auto table = lookupTable();
+	{
+		QMutexLocker locker(&table->strCacheMutex);
+		auto it = table->strCache.constFind(flags);
+		if (it != table->strCache.constEnd())
+			return it.value();
+	}
+
+	QVector<const QtnEnumValueInfo *> values;
+	collectFlagValues(flags, values);
+
+	QString result;
+	for (auto value : values)
+	{
+		if (!result.isEmpty())
+			result += QLatin1Char('|');
+
+		result += value->name();
+	}
+
+	QMutexLocker locker(&table->strCacheMutex);
+	if (table->strCache.size() >= QtnMaxEnumFlagsStrCacheSize)
+		table->strCache.clear();
+
+	table->strCache.insert(flags, result);
+	return result;
+}
+
+Qt::CaseSensitivity QtnEnumInfo::getCaseSensitivity() const
+{
+	return m_case_sensitivity;
+}
+
+void QtnEnumInfo::setCaseSensitivity(Qt::CaseSensitivity value)
+{
+	if (m_case_sensitivity == value)
+		return;
+
+	m_case_sensitivity = value;
+	invalidateLookupTable();
+}
+
+std::shared_ptr<QtnEnumInfo::LookupTable> QtnEnumInfo::lookupTable() const
+{
+	// lookup data is immutable once published, concurrent readers
+	// may build their own tables and the last one wins
+	auto table = std::atomic_load(&m_lookupTable);
+	if (table)
+		return table;
+
+	table = std::make_shared<LookupTable>();
+	for (int i = 0, count = m_values.size(); i < count; i++)
+	{
+		auto &value = m_values.at(i);
+		for (quint32 bits = quint32(value.value()); bits != 0;
+			 bits &= bits - 1)
+		{
+			table->bitValues[qCountTrailingZeroBits(bits)].append(i);
+		}
+
+		auto name = (m_case_sensitivity == Qt::CaseSensitive)
+			? value.name()
+			: value.name().toCaseFolded();
+		// first value with the name is found, same as linear search
+		if (!table->nameIndex.contains(name))
+			table->nameIndex.insert(name, i);
+	}
+
+	std::atomic_store(&m_lookupTable, table);
+	return table;
+}
+
 void QtnEnumInfo::setIconByValue(QtnEnumValueType value, const QIcon &icon)
 {
 	for (auto &v : m_values)
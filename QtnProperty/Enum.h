@@ -24,6 +24,8 @@ limitations under the License.
 #include <QMetaEnum>
 #include <QIcon>
 
+#include <memory>
+
 typedef qint32 QtnEnumValueType;
 
 enum QtnEnumValueStateFlag
@@ -142,6 +144,14 @@ public:
 	bool toStr(QString &str, const QtnEnumValueInfo *value) const;
 	bool toStr(QString &str, QtnEnumValueType value) const;
 
+	// Values having any of flags bits in the order of getVector().
+	// Uses a bit to value table, so takes time linear in set bits.
+	void collectFlagValues(QtnEnumValueType flags,
+		QVector<const QtnEnumValueInfo *> &values) const;
+	// Names of values having any of flags bits separated by '|',
+	// results are memoized.
+	QString flagsToStr(QtnEnumValueType flags) const;
+
 	Qt::CaseSensitivity getCaseSensitivity() const;
 	void setCaseSensitivity(Qt::CaseSensitivity value);
 
@@ -154,9 +164,15 @@ public:
         Qt::CaseSensitivity cs = Qt::CaseSensitive);
 
 private:
+	struct LookupTable;
+	std::shared_ptr<LookupTable> lookupTable() const;
+	inline void invalidateLookupTable();
+
 	Qt::CaseSensitivity m_case_sensitivity;
 	QString m_name;
 	QVector<QtnEnumValueInfo> m_values;
+	// built on first lookup, reset when values may change
+	mutable std::shared_ptr<LookupTable> m_lookupTable;
 };
 
 bool QtnEnumInfo::isValid() const
@@ -171,6 +187,7 @@ const QString &QtnEnumInfo::name() const
 
 QVector<QtnEnumValueInfo> &QtnEnumInfo::getVector()
 {
+	invalidateLookupTable();
 	return m_values;
 }
 
@@ -179,4 +196,9 @@ const QVector<QtnEnumValueInfo> &QtnEnumInfo::getVector() const
 	return m_values;
 }
 
+void QtnEnumInfo::invalidateLookupTable()
+{
+	std::atomic_store(&m_lookupTable, std::shared_ptr<LookupTable>());
+}
+
 #endif // QTN_ENUM_H
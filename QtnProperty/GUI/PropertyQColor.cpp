@@ -18,6 +18,8 @@ limitations under the License.
 #include "PropertyQColor.h"
 
 #include "QtnProperty/Auxiliary/PropertyDelegateInfo.h"
+#include "QtnProperty/Auxiliary/PropertyCbor.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
 
 QtnPropertyQColorBase::QtnPropertyQColorBase(QObject *parent)
 	: QtnStructPropertyBase<QColor, QtnPropertyIntCallback>(parent)
@@ -88,13 +90,94 @@ bool QtnPropertyQColorBase::toStrImpl(QString &str) const
 	return QtnPropertyQColor::strFromColor(value(), str);
 }
 
-bool QtnPropertyQColor::colorFromStr(const QString &str, QColor &color)
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyQColorBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
 {
-	QColor newColor(str.trimmed());
-	if (!newColor.isValid())
+	quint64 value = 0;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
+
+	if (value > std::numeric_limits<QRgb>::max())
 		return false;
 
-	color = newColor;
+	return setValue(QColor::fromRgba(QRgb(value)), reason);
+}
+
+bool QtnPropertyQColorBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(quint64(value().rgba()));
+	return true;
+}
+#endif
+
+static int qtnHexDigit(QChar ch)
+{
+	auto c = ch.unicode();
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return -1;
+}
+
+bool QtnPropertyQColor::colorFromStr(
+	const QString &str, QColor &color, int *errorPos)
+{
+	QtnStrParser parser(str);
+	parser.skipSpaces();
+	int start = parser.position();
+	QStringRef token;
+	if (!parser.readToken(token, QLatin1String("")))
+		return parser.failed(errorPos);
+
+	int digitCount = token.size() - 1;
+	if (token.at(0) != QLatin1Char('#') ||
+		(digitCount != 3 && digitCount != 6 && digitCount != 8))
+	{
+		// named colors and rare hex forms are resolved by Qt
+		QColor newColor(token.toString());
+		if (!newColor.isValid())
+		{
+			parser.fail(start);
+			return parser.failed(errorPos);
+		}
+
+		color = newColor;
+		return true;
+	}
+
+	quint32 rgba = 0;
+	for (int i = 1; i <= digitCount; i++)
+	{
+		int digit = qtnHexDigit(token.at(i));
+		if (digit < 0)
+		{
+			parser.fail(start + i);
+			return parser.failed(errorPos);
+		}
+
+		rgba = (rgba << 4) | quint32(digit);
+	}
+
+	switch (digitCount)
+	{
+		case 3:
+			color.setRgb(int(((rgba >> 8) & 0xF) * 0x11),
+				int(((rgba >> 4) & 0xF) * 0x11), int((rgba & 0xF) * 0x11));
+			break;
+
+		case 6:
+			color.setRgb(QRgb(rgba));
+			break;
+
+		default:
+			color.setRgba(QRgb(rgba));
+			break;
+	}
+
 	return true;
 }
 
@@ -51,6 +51,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	P_PROPERTY_DECL_MEMBER_OPERATORS(QtnPropertyQColorBase)
 };
 
@@ -93,7 +100,9 @@ public:
 	static QString blueDisplayName();
 	static QString blueDescriptionFmt();
 
-	static bool colorFromStr(const QString &str, QColor &color);
+	// errorPos receives the index of unexpected input on failure
+	static bool colorFromStr(
+		const QString &str, QColor &color, int *errorPos = nullptr);
 	static bool strFromColor(const QColor &color, QString &str);
 
 	P_PROPERTY_DECL_MEMBER_OPERATORS2(QtnPropertyQColor, QtnPropertyQColorBase)
@@ -16,6 +16,8 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertyQFont.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
+
 #include <QFontDatabase>
 
 QtnPropertyQFontBase::QtnPropertyQFontBase(QObject *parent)
@@ -27,11 +29,7 @@ bool QtnPropertyQFontBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
 	QFont font;
-
-	if (!font.fromString(str.trimmed()))
-		return false;
-
-	return setValue(font, reason);
+	return QtnPropertyQFont::fontFromStr(str, font) && setValue(font, reason);
 }
 
 bool QtnPropertyQFontBase::toStrImpl(QString &str) const
@@ -46,6 +44,54 @@ QtnPropertyQFont::QtnPropertyQFont(QObject *parent)
 {
 }
 
+bool QtnPropertyQFont::fontFromStr(
+	const QString &str, QFont &font, int *errorPos)
+{
+	// Only checks "family,pointSize,pixelSize,styleHint,weight,style,
+	// underline,strikeOut,fixedPitch,rawMode" fields to locate an error,
+	// the rest of the format is up to QFont.
+	enum
+	{
+		NumericFieldCount = 9
+	};
+
+	QtnStrParser parser(str);
+	QStringRef family;
+	if (!parser.readToken(family, QLatin1String(",")))
+		return parser.failed(errorPos);
+
+	for (int i = 0; i < NumericFieldCount && !parser.atEnd(); i++)
+	{
+		if (!parser.readChar(QLatin1Char(',')))
+			return parser.failed(errorPos);
+
+		// QFont::toString writes fractional point size
+		bool ok;
+		if (i == 0)
+		{
+			double pointSize = 0.0;
+			ok = parser.readNumber(pointSize);
+		} else
+		{
+			int field = 0;
+			ok = parser.readNumber(field);
+		}
+
+		if (!ok)
+			return parser.failed(errorPos);
+	}
+
+	QFont newFont;
+	if (!newFont.fromString(str.trimmed()))
+	{
+		parser.fail(family.position());
+		return parser.failed(errorPos);
+	}
+
+	font = newFont;
+	return true;
+}
+
 QString QtnPropertyQFont::getPixelStr()
 {
 	return tr("Pixel");
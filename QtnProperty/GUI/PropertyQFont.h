@@ -70,6 +70,10 @@ private:
 public:
 	explicit QtnPropertyQFont(QObject *parent);
 
+	// errorPos receives the index of unexpected input on failure
+	static bool fontFromStr(
+		const QString &str, QFont &font, int *errorPos = nullptr);
+
 	static QString getPixelStr();
 	static QString getPointStr();
 	static QString getPreferDefaultStr();
@@ -17,6 +17,8 @@ limitations under the License.
 
 #include "PropertyQPen.h"
 #include "QtnProperty/GUI/PropertyQColor.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
+#include "QtnProperty/Auxiliary/PropertyEnumRegistry.h"
 
 #include <QMap>
 #include <QMetaEnum>
@@ -95,98 +97,98 @@ QtnPropertyQPenBase::QtnPropertyQPenBase(QObject *parent)
 {
 }
 
-const QtnEnumInfo &QtnPropertyQPenBase::penStyleEnum()
+template <typename T>
+static QtnEnumInfo qtnPenEnumInfo(T mask)
 {
-	static QtnEnumInfo enumInfo;
-	if (!enumInfo.isValid())
+	auto enumInfo = QtnEnumInfo::withEnum<T>(true);
+	auto &vec = enumInfo.getVector();
+	for (auto it = vec.begin(); it != vec.end(); ++it)
 	{
-		enumInfo = QtnEnumInfo::withEnum<Qt::PenStyle>(true);
-		auto &vec = enumInfo.getVector();
-		for (auto it = vec.begin(); it != vec.end(); ++it)
+		if (it->value() == mask)
 		{
-			if (it->value() == Qt::MPenStyle)
-			{
-				vec.erase(it);
-				break;
-			}
+			vec.erase(it);
+			break;
 		}
 	}
 	return enumInfo;
 }
 
+const QtnEnumInfo &QtnPropertyQPenBase::penStyleEnum()
+{
+	static const int id = QtnEnumRegistry::registerEnum(
+		[]() -> QtnEnumInfo { return qtnPenEnumInfo(Qt::MPenStyle); });
+	return QtnEnumRegistry::enumInfo(id);
+}
+
 const QtnEnumInfo &QtnPropertyQPenBase::penCapStyleEnum()
 {
-	static QtnEnumInfo enumInfo;
-	if (!enumInfo.isValid())
-	{
-		enumInfo = QtnEnumInfo::withEnum<Qt::PenCapStyle>(true);
-		auto &vec = enumInfo.getVector();
-		for (auto it = vec.begin(); it != vec.end(); ++it)
-		{
-			if (it->value() == Qt::MPenCapStyle)
-			{
-				vec.erase(it);
-				break;
-			}
-		}
-	}
-	return enumInfo;
+	static const int id = QtnEnumRegistry::registerEnum(
+		[]() -> QtnEnumInfo { return qtnPenEnumInfo(Qt::MPenCapStyle); });
+	return QtnEnumRegistry::enumInfo(id);
 }
 
 const QtnEnumInfo &QtnPropertyQPenBase::penJoinStyleEnum()
 {
-	static QtnEnumInfo enumInfo;
-	if (!enumInfo.isValid())
-	{
-		enumInfo = QtnEnumInfo::withEnum<Qt::PenJoinStyle>(true);
-		auto &vec = enumInfo.getVector();
-		for (auto it = vec.begin(); it != vec.end(); ++it)
-		{
-			if (it->value() == Qt::MPenJoinStyle)
-			{
-				vec.erase(it);
-				break;
-			}
-		}
-	}
-	return enumInfo;
+	static const int id = QtnEnumRegistry::registerEnum(
+		[]() -> QtnEnumInfo { return qtnPenEnumInfo(Qt::MPenJoinStyle); });
+	return QtnEnumRegistry::enumInfo(id);
 }
 
-bool QtnPropertyQPenBase::penFromStr(const QString &str, QPen &pen)
+bool QtnPropertyQPenBase::penFromStr(
+	const QString &str, QPen &pen, int *errorPos)
 {
-	QStringList penParts = str.split(',');
-	if (penParts.size() != 5)
-		return false;
+	// "color, style, width, capStyle, joinStyle"
+	QtnStrParser parser(str);
+	auto readEnum = [&parser](const QtnEnumInfo &enumInfo,
+						QtnEnumValueType &value) -> bool //
+	{
+		parser.skipSpaces();
+		int position = parser.position();
+		QStringRef token;
+		if (!parser.readToken(token, QLatin1String(",")))
+			return false;
 
-	QColor color;
-	if (!QtnPropertyQColor::colorFromStr(penParts[0], color))
-		return false;
+		auto enumValue = enumInfo.fromStr(token.toString());
+		if (!enumValue)
+			return parser.fail(position);
 
-	auto styleEnum = penStyleEnum().fromStr(penParts[1]);
-	if (!styleEnum)
-		return false;
-	auto style = Qt::PenStyle(styleEnum->value());
+		value = enumValue->value();
+		return true;
+	};
 
-	bool ok = false;
-	int width = penParts[2].trimmed().toInt(&ok);
-	if (!ok)
-		return false;
+	QStringRef colorToken;
+	if (!parser.readToken(colorToken, QLatin1String(",")))
+		return parser.failed(errorPos);
 
-	auto capStyleEnum = penCapStyleEnum().fromStr(penParts[3]);
-	if (!capStyleEnum)
-		return false;
-	auto capStyle = Qt::PenCapStyle(capStyleEnum->value());
+	QColor color;
+	int colorErrorPos = -1;
+	if (!QtnPropertyQColor::colorFromStr(
+			colorToken.toString(), color, &colorErrorPos))
+	{
+		parser.fail(colorToken.position() + colorErrorPos);
+		return parser.failed(errorPos);
+	}
 
-	auto joinStyleEnum = penJoinStyleEnum().fromStr(penParts[4]);
-	if (!joinStyleEnum)
-		return false;
-	auto joinStyle = Qt::PenJoinStyle(joinStyleEnum->value());
+	QtnEnumValueType style = 0;
+	int width = 0;
+	QtnEnumValueType capStyle = 0;
+	QtnEnumValueType joinStyle = 0;
+	if (!parser.readChar(QLatin1Char(',')) ||
+		!readEnum(penStyleEnum(), style) ||
+		!parser.readChar(QLatin1Char(',')) || !parser.readNumber(width) ||
+		!parser.readChar(QLatin1Char(',')) ||
+		!readEnum(penCapStyleEnum(), capStyle) ||
+		!parser.readChar(QLatin1Char(',')) ||
+		!readEnum(penJoinStyleEnum(), joinStyle) || !parser.readEnd())
+	{
+		return parser.failed(errorPos);
+	}
 
 	pen.setColor(color);
-	pen.setStyle(style);
+	pen.setStyle(Qt::PenStyle(style));
 	pen.setWidth(width);
-	pen.setCapStyle(capStyle);
-	pen.setJoinStyle(joinStyle);
+	pen.setCapStyle(Qt::PenCapStyle(capStyle));
+	pen.setJoinStyle(Qt::PenJoinStyle(joinStyle));
 
 	return true;
 }
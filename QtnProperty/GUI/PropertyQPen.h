@@ -93,7 +93,9 @@ public:
 	static const QtnEnumInfo &penStyleEnum();
 	static const QtnEnumInfo &penCapStyleEnum();
 	static const QtnEnumInfo &penJoinStyleEnum();
-	static bool penFromStr(const QString &str, QPen &pen);
+	// errorPos receives the index of unexpected input on failure
+	static bool penFromStr(
+		const QString &str, QPen &pen, int *errorPos = nullptr);
 	static bool strFromPen(const QPen &pen, QString &str);
 
 protected:
@@ -16,6 +16,7 @@ limitations under the License.
 #include "PropertyQVector3D.h"
 
 #include "QtnProperty/Core/PropertyQPoint.h"
+#include "QtnProperty/Auxiliary/PropertyStrParser.h"
 
 QtnPropertyQVector3DBase::QtnPropertyQVector3DBase(QObject *parent)
 	: ParentClass(parent)
@@ -48,42 +49,9 @@ static const auto sPrefix = QStringLiteral("QVector3D");
 bool QtnPropertyQVector3DBase::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	auto text = str.trimmed();
-	if (!text.startsWith(sPrefix, Qt::CaseInsensitive))
-	{
-		return false;
-	}
-	text = text.mid(sPrefix.length()).trimmed();
-
-	if (!text.startsWith(QChar('(')) || !text.endsWith(QChar(')')))
-	{
-		return false;
-	}
-
-	text = text.mid(1, text.length() - 2).trimmed();
-	auto params = text.split(QChar(','));
-	if (params.size() != 3)
-	{
-		return false;
-	}
-
-	bool ok = false;
-	float x = params.at(0).trimmed().toFloat(&ok);
-
-	if (!ok)
-		return false;
-
-	float y = params.at(1).trimmed().toFloat(&ok);
-
-	if (!ok)
-		return false;
-
-	float z = params.at(2).trimmed().toFloat(&ok);
-
-	if (!ok)
-		return false;
-
-	return setValue(QVector3D(x, y, z), reason);
+	QVector3D vector;
+	return QtnPropertyQVector3D::vectorFromStr(str, vector) &&
+		setValue(vector, reason);
 }
 
 bool QtnPropertyQVector3DBase::toStrImpl(QString &str) const
@@ -126,3 +94,15 @@ QtnPropertyQVector3DCallback::QtnPropertyQVector3DCallback(QObject *parent)
 	: QtnSinglePropertyCallback<QtnPropertyQVector3DBase>(parent)
 {
 }
+
+bool QtnPropertyQVector3D::vectorFromStr(
+	const QString &str, QVector3D &vector, int *errorPos)
+{
+	float v[3];
+	QtnStrParser parser(str);
+	if (!parser.readTuple(QLatin1String("QVector3D"), v, 3))
+		return parser.failed(errorPos);
+
+	vector = QVector3D(v[0], v[1], v[2]);
+	return true;
+}
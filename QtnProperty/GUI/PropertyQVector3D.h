@@ -80,6 +80,9 @@ public:
 	static QString zDisplayName();
 	static QString zDescriptionFmt();
 	static QString getToStringFormat();
+	// errorPos receives the index of unexpected input on failure
+	static bool vectorFromStr(
+		const QString &str, QVector3D &vector, int *errorPos = nullptr);
 
 	P_PROPERTY_DECL_MEMBER_OPERATORS2(
 		QtnPropertyQVector3D, QtnPropertyQVector3DBase)
@@ -42,6 +42,7 @@ limitations under the License.
 #include "MultiProperty.h"
 #include "QObjectPropertySet.h"
 #include "Utils/AccessibilityProxy.h"
+#include "Auxiliary/PropertyEnumRegistry.h"
 
 #include <QCoreApplication>
 #include <QTranslator>
@@ -174,4 +175,7 @@ void qtnPropertyInstallTranslations(const QLocale &locale)
 	{
 		QCoreApplication::installTranslator(&translator);
 	}
+
+	// built-in enum infos are translated when built
+	QtnEnumRegistry::retranslate();
 }
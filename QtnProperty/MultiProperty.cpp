@@ -530,9 +530,7 @@ void QtnMultiPropertyDelegate::applyAttributesImpl(
 					multiSet = new QtnPropertySet(
 						subSet->childrenOrder(), subSet->compareFunc());
 					multiSet->setName(subSet->name());
-					multiSet->setDisplayName(subSet->displayName());
-					multiSet->setDescription(subSet->description());
-					multiSet->setHelp(subSet->help());
+					multiSet->setMetadata(subSet->metadata());
 					multiSet->setId(subSet->id());
 					multiSet->setState(subSet->stateLocal());
 
@@ -552,9 +550,7 @@ void QtnMultiPropertyDelegate::applyAttributesImpl(
 					multiProperty =
 						new QtnMultiProperty(property->metaObject());
 					multiProperty->setName(property->name());
-					multiProperty->setDisplayName(property->displayName());
-					multiProperty->setDescription(property->description());
-					multiProperty->setHelp(property->help());
+					multiProperty->setMetadata(property->metadata());
 					multiProperty->setId(property->id());
 
 					addSubProperty(multiProperty);
@@ -658,9 +654,7 @@ void qtnPropertiesToMultiSet(
 				multiSet = new QtnPropertySet(
 					subSet->childrenOrder(), subSet->compareFunc());
 				multiSet->setName(subSet->name());
-				multiSet->setDisplayName(subSet->displayName());
-				multiSet->setDescription(subSet->description());
-				multiSet->setHelp(subSet->help());
+				multiSet->setMetadata(subSet->metadata());
 				multiSet->setId(subSet->id());
 				multiSet->setState(subSet->stateLocal());
 
@@ -679,9 +673,7 @@ void qtnPropertiesToMultiSet(
 			{
 				multiProperty = new QtnMultiProperty(property->metaObject());
 				multiProperty->setName(property->name());
-				multiProperty->setDisplayName(property->displayName());
-				multiProperty->setDescription(property->description());
-				multiProperty->setHelp(property->help());
+				multiProperty->setMetadata(property->metadata());
 				multiProperty->setId(property->id());
 
 				target->addChildProperty(multiProperty, true);
@@ -19,6 +19,7 @@ limitations under the License.
 
 #include "PropertySet.h"
 #include "PropertyConnector.h"
+#include "Auxiliary/PropertyCbor.h"
 
 #ifdef SCRIPT_ENABLED
 #include <QScriptEngine>
@@ -35,7 +36,8 @@ class QtnPropertyDelegateInfoGetter
 	Q_DISABLE_COPY(QtnPropertyDelegateInfoGetter)
 
 public:
-	virtual QtnPropertyDelegateInfo *delegateInfo() = 0;
+	virtual const QtnPropertyDelegateInfo *delegateInfo() = 0;
+	virtual void collectMemoryUsage(QtnMemoryUsage &usage) const = 0;
 
 	virtual ~QtnPropertyDelegateInfoGetter() = default;
 
@@ -48,10 +50,11 @@ class QtnPropertyDelegateInfoGetterValue : public QtnPropertyDelegateInfoGetter
 public:
 	QtnPropertyDelegateInfoGetterValue(const QtnPropertyDelegateInfo &delegate);
 
-	QtnPropertyDelegateInfo *delegateInfo() override;
+	const QtnPropertyDelegateInfo *delegateInfo() override;
+	void collectMemoryUsage(QtnMemoryUsage &usage) const override;
 
 private:
-	QtnPropertyDelegateInfo m_delegateInfo;
+	QtnPropertyDelegateInfo::Ptr m_delegateInfo;
 };
 
 class QtnPropertyDelegateInfoGetterCallback
@@ -61,11 +64,12 @@ public:
 	QtnPropertyDelegateInfoGetterCallback(
 		const QtnPropertyBase::DelegateInfoCallback &callback);
 
-	QtnPropertyDelegateInfo *delegateInfo() override;
+	const QtnPropertyDelegateInfo *delegateInfo() override;
+	void collectMemoryUsage(QtnMemoryUsage &usage) const override;
 
 private:
 	QtnPropertyBase::DelegateInfoCallback m_callback;
-	QScopedPointer<QtnPropertyDelegateInfo> m_delegateInfo;
+	QtnPropertyDelegateInfo::Ptr m_delegateInfo;
 };
 
 #ifdef SCRIPT_ENABLED
@@ -185,6 +189,7 @@ extern bool qtnPropertyRegister();
 QtnPropertyBase::QtnPropertyBase(QObject *parent)
 	: QObject(parent)
 	, mPropertyConnector(nullptr)
+	, mVarProperty(nullptr)
 	, m_masterProperty(nullptr)
 	, m_id(QtnPropertyIDInvalid)
 	, m_stateLocal(QtnPropertyStateNone)
@@ -247,9 +252,9 @@ void QtnPropertyBase::setName(const QString &name)
 		return;
 
 	QtnPropertyChangeReason reason(QtnPropertyChangeReasonName);
-	if (m_displayName.isEmpty() && !name.isEmpty())
+	if (m_metadata.displayName().isEmpty() && !name.isEmpty())
 	{
-		m_displayName = name;
+		m_metadata.setDisplayName(name);
 		reason |= QtnPropertyChangeReasonDisplayName;
 	}
 
@@ -263,56 +268,97 @@ void QtnPropertyBase::setName(const QString &name)
 
 void QtnPropertyBase::setDisplayName(const QString &displayName)
 {
-	if (displayName == m_displayName)
+	if (displayName == m_metadata.displayName())
 		return;
 
 	emit propertyWillChange(QtnPropertyChangeReasonDisplayName,
 		QtnPropertyValuePtr(&displayName), qMetaTypeId<QString>());
 
-	m_displayName = displayName;
+	m_metadata.setDisplayName(displayName);
 
 	emit propertyDidChange(QtnPropertyChangeReasonDisplayName);
 }
 
 void QtnPropertyBase::setDescription(const QString &description)
 {
-	if (m_description == description)
+	if (m_metadata.description() == description)
 		return;
 
 	emit propertyWillChange(QtnPropertyChangeReasonDescription,
 		QtnPropertyValuePtr(&description), qMetaTypeId<QString>());
 
-	m_description = description;
+	m_metadata.setDescription(description);
 
 	emit propertyDidChange(QtnPropertyChangeReasonDescription);
 }
 
 void QtnPropertyBase::setHelp(const QString &help)
 {
-	if (m_help == help)
+	if (m_metadata.help() == help)
 		return;
 
 	emit propertyWillChange(QtnPropertyChangeReasonHelp,
 		QtnPropertyValuePtr(&help), qMetaTypeId<QString>());
 
-	m_help = help;
+	m_metadata.setHelp(help);
 
 	emit propertyDidChange(QtnPropertyChangeReasonHelp);
 }
 
 void QtnPropertyBase::setIcon(const QIcon &icon)
 {
-	if (m_icon.cacheKey() == icon.cacheKey())
+	if (m_metadata.icon().cacheKey() == icon.cacheKey())
 		return;
 
 	// emit propertyWillChange(QtnPropertyChangeReasonUpdateDelegate,
 	// 	QtnPropertyValuePtr(const_cast<QIcon *>(&icon)), qMetaTypeId<QIcon>());
 
-	m_icon = icon;
+	m_metadata.setIcon(icon);
 
 	postUpdateEvent(QtnPropertyChangeReasonUpdateDelegate);
 }
 
+void QtnPropertyBase::setMetadata(const QtnPropertyMetadata &metadata)
+{
+	if (m_metadata.isSharedWith(metadata))
+		return;
+
+	QtnPropertyChangeReason reason;
+	if (m_metadata.displayName() != metadata.displayName())
+		reason |= QtnPropertyChangeReasonDisplayName;
+	if (m_metadata.description() != metadata.description())
+		reason |= QtnPropertyChangeReasonDescription;
+	if (m_metadata.help() != metadata.help())
+		reason |= QtnPropertyChangeReasonHelp;
+
+	bool iconChanged =
+		m_metadata.icon().cacheKey() != metadata.icon().cacheKey();
+
+	// equal metadata is just shared
+	if (!reason)
+	{
+		m_metadata = metadata;
+		if (iconChanged)
+			postUpdateEvent(QtnPropertyChangeReasonUpdateDelegate);
+		return;
+	}
+
+	emit propertyWillChange(reason, QtnPropertyValuePtr(&metadata),
+		qMetaTypeId<QtnPropertyMetadata>());
+
+	m_metadata = metadata;
+
+	emit propertyDidChange(reason);
+
+	if (iconChanged)
+		postUpdateEvent(QtnPropertyChangeReasonUpdateDelegate);
+}
+
+void QtnPropertyBase::internMetadata()
+{
+	m_metadata = m_metadata.interned();
+}
+
 void QtnPropertyBase::setId(QtnPropertyID id)
 {
 	if (m_id == id)
@@ -620,6 +666,48 @@ bool QtnPropertyBase::toVariant(QVariant &var) const
 	return toVariantImpl(var);
 }
 
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyBase::fromCbor(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	if (!isWritable())
+	{
+		reader.next();
+		return false;
+	}
+
+	return fromCborImpl(reader, reason);
+}
+
+bool QtnPropertyBase::toCbor(QCborStreamWriter &writer) const
+{
+	return toCborImpl(writer);
+}
+
+bool QtnPropertyBase::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	QString str;
+	if (!qtnCborReadValue(reader, str))
+	{
+		reader.next();
+		return false;
+	}
+
+	return fromStr(str, reason);
+}
+
+bool QtnPropertyBase::toCborImpl(QCborStreamWriter &writer) const
+{
+	QString str;
+	if (!toStr(str))
+		return false;
+
+	writer.append(str);
+	return true;
+}
+#endif
+
 QtnProperty *QtnPropertyBase::asProperty()
 {
 	return nullptr;
@@ -927,6 +1015,31 @@ QtnPropertyState QtnPropertyBase::state() const
 	return m_stateLocal | m_stateInherited;
 }
 
+QtnMemoryUsage QtnPropertyBase::memoryUsage() const
+{
+	QtnMemoryUsage usage;
+	collectMemoryUsage(usage);
+	return usage;
+}
+
+void QtnPropertyBase::collectMemoryUsage(QtnMemoryUsage &usage) const
+{
+	memoryUsageImpl(usage);
+}
+
+void QtnPropertyBase::memoryUsageImpl(QtnMemoryUsage &usage) const
+{
+	usage.addProperty(metaObject()->className(), sizeof(QtnPropertyBase));
+	usage.addString(objectName());
+	m_metadata.collectMemoryUsage(usage);
+
+	if (!m_delegateInfoGetter.isNull())
+		m_delegateInfoGetter->collectMemoryUsage(usage);
+
+	if (mPropertyConnector)
+		usage.add(QtnMemoryUsage::Connections, sizeof(QtnPropertyConnector));
+}
+
 const QtnPropertyDelegateInfo *QtnPropertyBase::delegateInfo() const
 {
 	if (m_delegateInfoGetter.isNull())
@@ -952,27 +1065,35 @@ void QtnPropertyBase::setDelegateInfoCallback(
 void QtnPropertyBase::setDelegateAttribute(
 	const QByteArray &attributeName, const QVariant &attributeValue)
 {
-	if (m_delegateInfoGetter.isNull())
-	{
-		setDelegateInfo(QtnPropertyDelegateInfo());
-	}
-	Q_ASSERT(!m_delegateInfoGetter.isNull());
+	// interned delegate info is immutable, so it is replaced
+	QtnPropertyDelegateInfo delegate;
+	auto current = delegateInfo();
+	if (current)
+		delegate = *current;
 
-	auto delegate = m_delegateInfoGetter->delegateInfo();
-	Q_ASSERT(delegate);
-	delegate->attributes[attributeName] = attributeValue;
+	delegate.attributes[attributeName] = attributeValue;
+	setDelegateInfo(delegate);
 	postUpdateEvent(QtnPropertyChangeReasonUpdateDelegate);
 }
 
 QtnPropertyDelegateInfoGetterValue::QtnPropertyDelegateInfoGetterValue(
 	const QtnPropertyDelegateInfo &delegate)
-	: m_delegateInfo(delegate)
+	: m_delegateInfo(delegate.interned())
+{
+}
+
+const QtnPropertyDelegateInfo *
+QtnPropertyDelegateInfoGetterValue::delegateInfo()
 {
+	return m_delegateInfo.get();
 }
 
-QtnPropertyDelegateInfo *QtnPropertyDelegateInfoGetterValue::delegateInfo()
+void QtnPropertyDelegateInfoGetterValue::collectMemoryUsage(
+	QtnMemoryUsage &usage) const
 {
-	return &m_delegateInfo;
+	usage.add(QtnMemoryUsage::DelegateInfos,
+		sizeof(QtnPropertyDelegateInfoGetterValue), 0);
+	usage.addDelegateInfo(*m_delegateInfo);
 }
 
 QtnPropertyDelegateInfoGetterCallback::QtnPropertyDelegateInfoGetterCallback(
@@ -982,12 +1103,24 @@ QtnPropertyDelegateInfoGetterCallback::QtnPropertyDelegateInfoGetterCallback(
 	Q_ASSERT(callback != nullptr);
 }
 
-QtnPropertyDelegateInfo *QtnPropertyDelegateInfoGetterCallback::delegateInfo()
+const QtnPropertyDelegateInfo *
+QtnPropertyDelegateInfoGetterCallback::delegateInfo()
 {
-	if (m_delegateInfo.isNull())
+	if (!m_delegateInfo)
 	{
-		m_delegateInfo.reset(new QtnPropertyDelegateInfo(m_callback()));
+		m_delegateInfo = m_callback().interned();
 	}
 
-	return m_delegateInfo.data();
+	return m_delegateInfo.get();
+}
+
+void QtnPropertyDelegateInfoGetterCallback::collectMemoryUsage(
+	QtnMemoryUsage &usage) const
+{
+	usage.add(QtnMemoryUsage::DelegateInfos,
+		sizeof(QtnPropertyDelegateInfoGetterCallback), 0);
+
+	// not created yet
+	if (m_delegateInfo)
+		usage.addDelegateInfo(*m_delegateInfo);
 }
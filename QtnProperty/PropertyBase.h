@@ -20,16 +20,21 @@ limitations under the License.
 
 #include "Auxiliary/PropertyAux.h"
 #include "Auxiliary/PropertyDelegateInfo.h"
+#include "Auxiliary/PropertyMetadata.h"
+#include "Auxiliary/PropertyMemoryUsage.h"
 #include <QDataStream>
 #include <QVariant>
 #include <QIcon>
 #include <functional>
 
 class QScriptEngine;
+class QCborStreamReader;
+class QCborStreamWriter;
 class QtnPropertySet;
 class QtnProperty;
 class QtnPropertyConnector;
 class QtnPropertyDelegateInfoGetter;
+class VarProperty;
 
 class QTN_IMPORT_EXPORT QtnPropertyBase : public QObject
 {
@@ -48,8 +53,10 @@ class QTN_IMPORT_EXPORT QtnPropertyBase : public QObject
 
 	friend class QtnPropertyConnector;
 	friend class QtnPropertySet;
+	friend class VarProperty;
 
 	inline void setConnector(QtnPropertyConnector *connector);
+	inline void setVarProperty(VarProperty *varProperty);
 
 public:
 	static const quint8 STORAGE_VERSION;
@@ -75,6 +82,12 @@ public:
 	inline QIcon icon() const;
 	void setIcon(const QIcon &icon);
 
+	// display name, description, help and icon
+	inline const QtnPropertyMetadata &metadata() const;
+	void setMetadata(const QtnPropertyMetadata &metadata);
+	// shares metadata with other properties having the same one
+	void internMetadata();
+
 	inline QtnPropertyID id() const;
 	void setId(QtnPropertyID id);
 
@@ -97,6 +110,9 @@ public:
 	inline QtnPropertyConnector *getConnector() const;
 	inline bool isQObjectProperty() const;
 
+	// node of QtnCustomPropertyWidget data, if any
+	inline VarProperty *getVarProperty() const;
+
 	void setLocked(bool locked,
 		QtnPropertyChangeReason reason = QtnPropertyChangeReason());
 	void toggleLock(QtnPropertyChangeReason reason = QtnPropertyChangeReason());
@@ -135,6 +151,13 @@ public:
 		QtnPropertyChangeReason reason = QtnPropertyChangeReasonNewValue);
 	bool toVariant(QVariant &var) const;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion
+	bool fromCbor(QCborStreamReader &reader,
+		QtnPropertyChangeReason reason = QtnPropertyChangeReasonNewValue);
+	bool toCbor(QCborStreamWriter &writer) const;
+#endif
+
 	// casts
 	virtual QtnProperty *asProperty();
 	virtual const QtnProperty *asProperty() const;
@@ -158,6 +181,10 @@ public:
 	void setDelegateAttribute(
 		const QByteArray &attributeName, const QVariant &attributeValue);
 
+	// memory accounting, includes child properties
+	QtnMemoryUsage memoryUsage() const;
+	void collectMemoryUsage(QtnMemoryUsage &usage) const;
+
 Q_SIGNALS:
 	void propertyWillChange(QtnPropertyChangeReason reason,
 		QtnPropertyValuePtr newValue, int typeId);
@@ -182,6 +209,13 @@ protected:
 		const QVariant &var, QtnPropertyChangeReason reason);
 	virtual bool toVariantImpl(QVariant &var) const;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	virtual bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason);
+	virtual bool toCborImpl(QCborStreamWriter &writer) const;
+#endif
+
 	// inherited states support
 	virtual void updateStateInherited(bool force);
 	void setStateInherited(QtnPropertyState stateToSet, bool force = false);
@@ -194,6 +228,9 @@ protected:
 
 	virtual void updatePropertyState();
 
+	// memory accounting implementation
+	virtual void memoryUsageImpl(QtnMemoryUsage &usage) const;
+
 private:
 	QtnPropertyState masterPropertyState() const;
 	void onMasterPropertyDestroyed(QObject *object);
@@ -202,13 +239,11 @@ private:
 
 private:
 	QtnPropertyConnector *mPropertyConnector;
+	VarProperty *mVarProperty;
 	QtnPropertyBase *m_masterProperty;
 
-	QString m_displayName;
-	QString m_description;
-	QIcon m_icon;
+	QtnPropertyMetadata m_metadata;
 	QtnPropertyID m_id;
-	QString m_help;
 
 	QtnPropertyState m_stateLocal;
 	QtnPropertyState m_stateInherited;
@@ -226,22 +261,27 @@ QString QtnPropertyBase::name() const
 
 QString QtnPropertyBase::displayName() const
 {
-	return m_displayName;
+	return m_metadata.displayName();
 }
 
 QString QtnPropertyBase::description() const
 {
-	return m_description;
+	return m_metadata.description();
 }
 
 QString QtnPropertyBase::help() const
 {
-	return m_help;
+	return m_metadata.help();
 }
 
 QIcon QtnPropertyBase::icon() const
 {
-	return m_icon;
+	return m_metadata.icon();
+}
+
+const QtnPropertyMetadata &QtnPropertyBase::metadata() const
+{
+	return m_metadata;
 }
 
 QtnPropertyID QtnPropertyBase::id() const
@@ -274,6 +314,16 @@ bool QtnPropertyBase::isQObjectProperty() const
 	return (nullptr != getConnector());
 }
 
+void QtnPropertyBase::setVarProperty(VarProperty *varProperty)
+{
+	mVarProperty = varProperty;
+}
+
+VarProperty *QtnPropertyBase::getVarProperty() const
+{
+	return mVarProperty;
+}
+
 QtnPropertyState QtnPropertyBase::stateLocal() const
 {
 	return m_stateLocal;
@@ -85,6 +85,31 @@ QTN_IMPORT_EXPORT QByteArray qtnHeightDescriptionAttr();
 QTN_IMPORT_EXPORT QByteArray qtnCoordinateModeAttr();
 QTN_IMPORT_EXPORT QByteArray qtnFieldDelegateNameAttr();
 
+// Pre-registered ids of frequently used attributes,
+// see qtnDelegateAttributeId
+enum QtnDelegateAttributeId
+{
+	QtnSuffixAttrId,
+	QtnMinAttrId,
+	QtnMaxAttrId,
+	QtnStepAttrId,
+	QtnMultiplierAttrId,
+	QtnPrecisionAttrId,
+	QtnMultiLineEditAttrId,
+	QtnMaxLengthAttrId,
+	QtnPlaceholderAttrId,
+	QtnLabelFalseAttrId,
+	QtnLabelTrueAttrId,
+	QtnFillColorAttrId,
+	QtnLiveUpdateAttrId,
+	QtnDrawBorderAttrId,
+	QtnUpdateByScrollAttrId,
+	QtnAnimateAttrId,
+	QtnToolTipAttrId,
+	QtnDrawTextAttrId,
+	QtnBuiltInAttrIdCount
+};
+
 QTN_IMPORT_EXPORT QByteArray qtnLineEditDelegate();
 QTN_IMPORT_EXPORT QByteArray qtnSelectFileDelegate();
 QTN_IMPORT_EXPORT QByteArray qtnSelectFontDelegate();
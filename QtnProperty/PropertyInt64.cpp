@@ -24,8 +24,11 @@ limitations under the License.
 #include "Delegates/Utils/PropertyDelegateSliderBox.h"
 #include "Delegates/Utils/PropertyDelegateOpacityBox.h"
 #include "Utils/QtnInt64SpinBox.h"
+#include "Utils/InplaceEditing.h"
 #include "MultiProperty.h"
 #include "PropertyDelegateAttrs.h"
+#include "Auxiliary/PropertyCbor.h"
+#include "Auxiliary/PropertyNumber.h"
 
 #include <QLocale>
 #include <QKeyEvent>
@@ -52,10 +55,8 @@ QtnPropertyInt64Base::QtnPropertyInt64Base(QObject *parent)
 bool QtnPropertyInt64Base::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	bool ok = false;
-	ValueType value = str.toLongLong(&ok);
-
-	if (!ok)
+	ValueType value = 0;
+	if (!qtnStrToNumber(str, value))
 		return false;
 
 	return setValue(value, reason);
@@ -63,9 +64,27 @@ bool QtnPropertyInt64Base::fromStrImpl(
 
 bool QtnPropertyInt64Base::toStrImpl(QString &str) const
 {
-	str = QString::number(value());
+	str = qtnNumberToStr(value());
+	return true;
+}
+
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyInt64Base::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	qint64 value = 0;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
+
+	return setValue(value, reason);
+}
+
+bool QtnPropertyInt64Base::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(qint64(value()));
 	return true;
 }
+#endif
 
 bool QtnPropertyInt64Base::fromVariantImpl(
 	const QVariant &var, QtnPropertyChangeReason reason)
@@ -103,6 +122,11 @@ void QtnPropertyDelegateInt64::Register(QtnPropertyDelegateFactory &factory)
 		qtnOpacityBoxDelegate());
 }
 
+bool QtnPropertyDelegateInt64::isShareable() const
+{
+	return true;
+}
+
 qint64 QtnPropertyDelegateInt64::stepValue() const
 {
 	return m_step.isValid() ? m_step.toLongLong() : owner().stepValue();
@@ -141,7 +165,7 @@ bool QtnPropertyDelegateInt64::acceptKeyPressedForInplaceEditImpl(
 QWidget *QtnPropertyDelegateInt64::createValueEditorImpl(
 	QWidget *parent, const QRect &rect, QtnInplaceInfo *inplaceInfo)
 {
-	auto spinBox = new QtnInt64SpinBox(parent);
+	auto spinBox = QtnInplaceEditorPool::acquire<QtnInt64SpinBox>(parent);
 	spinBox->setSuffix(m_suffix);
 	spinBox->setGeometry(rect);
 
@@ -158,10 +182,10 @@ QWidget *QtnPropertyDelegateInt64::createValueEditorImpl(
 void QtnPropertyDelegateInt64::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
-	info.loadAttribute(qtnSuffixAttr(), m_suffix);
-	m_min = info.attributes.value(qtnMinAttr());
-	m_max = info.attributes.value(qtnMaxAttr());
-	m_step = info.attributes.value(qtnStepAttr());
+	info.loadAttribute(QtnSuffixAttrId, m_suffix);
+	m_min = info.attributeValue(QtnMinAttrId);
+	m_max = info.attributeValue(QtnMaxAttrId);
+	m_step = info.attributeValue(QtnStepAttrId);
 	if (m_step.isValid())
 	{
 		bool ok;
@@ -198,6 +222,9 @@ QtnPropertyInt64SpinBoxHandler::QtnPropertyInt64SpinBoxHandler(
 
 	editor.setKeyboardTracking(false);
 	editor.installEventFilter(this);
+	coalesceUpdates = true;
+	QObject::connect(&editor, &QAbstractSpinBox::editingFinished, this,
+		&QtnPropertyInt64SpinBoxHandler::flushValue);
 	QObject::connect(&editor,
 		static_cast<void (QtnInt64SpinBox::*)(qint64)>(
 			&QtnInt64SpinBox::valueChanged),
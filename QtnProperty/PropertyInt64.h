@@ -36,6 +36,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	virtual bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	virtual bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	virtual bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	// variant conversion implementation
 	virtual bool fromVariantImpl(
 		const QVariant &var, QtnPropertyChangeReason reason) override;
@@ -90,6 +97,8 @@ public:
 
 	static void Register(QtnPropertyDelegateFactory &factory);
 
+	virtual bool isShareable() const override;
+
 	qint64 stepValue() const;
 	qint64 minValue() const;
 	qint64 maxValue() const;
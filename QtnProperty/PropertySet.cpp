@@ -16,9 +16,12 @@ limitations under the License.
 *******************************************************************************/
 
 #include "PropertySet.h"
+#include "Auxiliary/PropertyCbor.h"
 
 #include <QRegularExpression>
 #include <QJsonObject>
+#include <QHash>
+#include <QVector>
 #include <QDebug>
 
 void qtnAddPropertyAsChild(
@@ -38,6 +41,19 @@ void qtnRemovePropertyAsChild(QObject *parent, QtnPropertyBase *child)
 		propertySet->removeChildProperty(child);
 }
 
+bool qtnSplitPropertyPath(const QStringRef &path, QVector<QStringRef> &segments)
+{
+	segments = path.trimmed().split(QLatin1Char('.'));
+	for (auto &segment : segments)
+	{
+		segment = segment.trimmed();
+		if (segment.isEmpty())
+			return false;
+	}
+
+	return true;
+}
+
 QtnPropertySet::QtnPropertySet(QObject *parent)
 	: QtnPropertyBase(parent)
 	, m_childrenOrder(NoSort)
@@ -184,33 +200,7 @@ bool QtnPropertySet::addChildProperty(
 	emit propertyWillChange(QtnPropertyChangeReasonChildPropertyAdd,
 		QtnPropertyValuePtr(childProperty), qMetaTypeId<QtnPropertyBase *>());
 
-	switch (m_childrenOrder)
-	{
-		case NoSort:
-			break;
-
-		case Ascend:
-		case Descend:
-			index = 0;
-			for (int i = m_childProperties.size() - 1; i >= 0; --i)
-			{
-				auto p = m_childProperties.at(i);
-				int compare = m_compareFunc(childProperty, p);
-				if (compare == 0 ||
-					(m_childrenOrder == Ascend && compare > 0) ||
-					(m_childrenOrder == Descend && compare < 0))
-				{
-					index = i + 1;
-					break;
-				}
-			}
-			break;
-	}
-
-	if (index < 0)
-		m_childProperties.append(childProperty);
-	else
-		m_childProperties.insert(index, childProperty);
+	insertChildProperty(childProperty, index);
 
 	if (moveOwnership)
 		childProperty->setParent(this);
@@ -221,6 +211,39 @@ bool QtnPropertySet::addChildProperty(
 	return true;
 }
 
+bool QtnPropertySet::addChildProperties(
+	const QList<QtnPropertyBase *> &childProperties, bool moveOwnership,
+	int index)
+{
+	if (childProperties.isEmpty())
+		return false;
+
+	emit propertyWillChange(QtnPropertyChangeReasonChildPropertyAdd,
+		QtnPropertyValuePtr(childProperties.first()),
+		qMetaTypeId<QtnPropertyBase *>());
+
+	for (auto childProperty : childProperties)
+	{
+		Q_CHECK_PTR(childProperty);
+		insertChildProperty(childProperty, index);
+
+		if (index >= 0)
+			index++;
+
+		if (moveOwnership)
+			childProperty->setParent(this);
+	}
+
+	emit propertyDidChange(QtnPropertyChangeReasonChildPropertyAdd);
+
+	for (auto childProperty : childProperties)
+	{
+		childProperty->setStateInherited(state());
+	}
+
+	return true;
+}
+
 bool QtnPropertySet::removeChildProperty(QtnPropertyBase *childProperty)
 {
 	Q_CHECK_PTR(childProperty);
@@ -243,6 +266,38 @@ bool QtnPropertySet::removeChildProperty(QtnPropertyBase *childProperty)
 	return true;
 }
 
+void QtnPropertySet::insertChildProperty(
+	QtnPropertyBase *childProperty, int index)
+{
+	switch (m_childrenOrder)
+	{
+		case NoSort:
+			break;
+
+		case Ascend:
+		case Descend:
+			index = 0;
+			for (int i = m_childProperties.size() - 1; i >= 0; --i)
+			{
+				auto p = m_childProperties.at(i);
+				int compare = m_compareFunc(childProperty, p);
+				if (compare == 0 ||
+					(m_childrenOrder == Ascend && compare > 0) ||
+					(m_childrenOrder == Descend && compare < 0))
+				{
+					index = i + 1;
+					break;
+				}
+			}
+			break;
+	}
+
+	if (index < 0)
+		m_childProperties.append(childProperty);
+	else
+		m_childProperties.insert(index, childProperty);
+}
+
 QtnPropertySet *QtnPropertySet::createNew(QObject *parentForNew) const
 {
 	return createNewImpl(parentForNew);
@@ -306,63 +361,158 @@ bool QtnPropertySet::copyValuesImpl(
 	return false;
 }
 
-bool QtnPropertySet::fromStrImpl(
-	const QString &str, QtnPropertyChangeReason reason)
+// Resolves dot separated property paths the same way as
+// findChildProperties(path, Qt::FindChildrenRecursively) does,
+// but indexes the subtree only once for all lookups.
+class QtnPropertySetPathIndex
 {
-	static QRegExp parserLine(QStringLiteral("^\\s*([^=]+)=(.*)$"));
+	Q_DISABLE_COPY(QtnPropertySetPathIndex)
 
-	QStringList lines = str.split(QChar::LineFeed, QString::SkipEmptyParts);
+public:
+	explicit QtnPropertySetPathIndex(QtnPropertySet *root);
 
-	if (lines.isEmpty())
-		return true;
+	// returns nullptr if path is not found or ambiguous
+	QtnPropertyBase *find(const QStringRef &path);
 
-	bool ok = true;
+private:
+	void build(const QtnPropertySet *propertySet);
 
-	for (const auto &line : lines)
+	using Counts = QHash<const QtnPropertyBase *, int>;
+
+	QtnPropertySet *m_root;
+	bool m_built;
+	QHash<QString, QVector<QtnPropertyBase *>> m_byName;
+	QHash<const QtnPropertyBase *, const QtnPropertySet *> m_parents;
+};
+
+QtnPropertySetPathIndex::QtnPropertySetPathIndex(QtnPropertySet *root)
+	: m_root(root)
+	, m_built(false)
+{
+}
+
+QtnPropertyBase *QtnPropertySetPathIndex::find(const QStringRef &path)
+{
+	QVector<QStringRef> segments;
+	if (!qtnSplitPropertyPath(path, segments))
+		return nullptr;
+
+	if (!m_built)
 	{
-		if (!parserLine.exactMatch(line))
+		build(m_root);
+		m_built = true;
+	}
+
+	// number of matching chains ending at each property
+	Counts counts;
+	for (int i = 0, count = segments.size(); i < count; i++)
+	{
+		auto it = m_byName.constFind(segments.at(i).toString());
+		if (it == m_byName.constEnd())
+			return nullptr;
+
+		Counts nextCounts;
+		for (auto property : it.value())
 		{
-			qDebug() << "Cannot parse string: " << line;
-			ok = false;
-			continue;
+			int chains = 0;
+			if (i == 0)
+			{
+				chains = 1;
+			} else
+			{
+				for (auto parent = m_parents.value(property);
+					 parent && parent != m_root;
+					 parent = m_parents.value(parent))
+				{
+					chains += counts.value(parent);
+				}
+			}
+
+			if (chains > 0)
+				nextCounts[property] += chains;
 		}
 
-		QStringList params = parserLine.capturedTexts();
-		if (params.size() != 3)
+		if (nextCounts.isEmpty())
+			return nullptr;
+
+		counts.swap(nextCounts);
+	}
+
+	if (counts.size() != 1 || counts.cbegin().value() != 1)
+		return nullptr;
+
+	return const_cast<QtnPropertyBase *>(counts.cbegin().key());
+}
+
+void QtnPropertySetPathIndex::build(const QtnPropertySet *propertySet)
+{
+	for (auto childProperty : propertySet->childProperties())
+	{
+		m_byName[childProperty->name()].append(childProperty);
+		m_parents.insert(childProperty, propertySet);
+
+		auto childPropertySet = childProperty->asPropertySet();
+		if (childPropertySet)
+			build(childPropertySet);
+	}
+}
+
+bool QtnPropertySet::fromStrImpl(
+	const QString &str, QtnPropertyChangeReason reason)
+{
+	QtnPropertySetPathIndex index(this);
+
+	bool ok = true;
+
+	int size = str.size();
+	int lineStart = 0;
+	while (lineStart < size)
+	{
+		int lineEnd = str.indexOf(QChar::LineFeed, lineStart);
+		if (lineEnd < 0)
+			lineEnd = size;
+
+		QStringRef line = str.midRef(lineStart, lineEnd - lineStart);
+		lineStart = lineEnd + 1;
+
+		if (line.isEmpty())
+			continue;
+
+		// line format is "path=value", path cannot be empty
+		int eqPos = line.indexOf(QLatin1Char('='));
+		if (eqPos <= 0)
 		{
 			qDebug() << "Cannot parse string: " << line;
 			ok = false;
 			continue;
 		}
 
-		QString propertyPath = params[1];
-		QString propertyStrValue = params[2];
+		QStringRef propertyPath = line.left(eqPos);
 
-		QList<QtnPropertyBase *> subProperties =
-			findChildProperties(propertyPath, Qt::FindChildrenRecursively);
-		if (subProperties.size() != 1)
+		QtnPropertyBase *subProperty = index.find(propertyPath);
+		if (!subProperty)
 		{
 			qDebug() << "Ambiguous property path: " << propertyPath;
 			ok = false;
 			continue;
 		}
 
-		if (subProperties[0]->state() & QtnPropertyStateNonSerialized)
+		if (subProperty->state() & QtnPropertyStateNonSerialized)
 			continue;
 
-		propertyStrValue = propertyStrValue.trimmed();
+		QString propertyStrValue = line.mid(eqPos + 1).trimmed().toString();
 		if (propertyStrValue.startsWith('"') && propertyStrValue.endsWith('"'))
 		{
 			propertyStrValue =
 				propertyStrValue.mid(1, propertyStrValue.length() - 2);
 		}
 
-		if (!subProperties[0]->fromStr(propertyStrValue, reason))
+		if (!subProperty->fromStr(propertyStrValue, reason))
 		{
 			qDebug() << QString(
 				"Cannot convert property %1<%2> from string \"%3\"")
-							.arg(subProperties[0]->name(),
-								subProperties[0]->metaObject()->className(),
+							.arg(subProperty->name(),
+								subProperty->metaObject()->className(),
 								propertyStrValue);
 			ok = false;
 			continue;
@@ -518,6 +668,191 @@ bool QtnPropertySet::toVariantImpl(QVariant &v) const
 	return ok;
 }
 
+#ifdef QTN_CBOR_SUPPORT
+static QtnPropertyBase *qtnFindCborChild(
+	QtnPropertySet *propertySet, const QString &name)
+{
+	auto childProperties =
+		propertySet->findChildProperties(name, Qt::FindDirectChildrenOnly);
+	if (childProperties.size() != 1)
+		return nullptr;
+
+	return childProperties[0];
+}
+
+static bool qtnReadCborNames(
+	QCborStreamReader &reader, QHash<QtnPropertyID, QString> &names)
+{
+	if (!reader.isMap())
+	{
+		reader.next();
+		return false;
+	}
+
+	if (!reader.enterContainer())
+		return false;
+
+	bool ok = true;
+	while (reader.hasNext())
+	{
+		qint64 id = QtnPropertyIDInvalid;
+		QString name;
+		if (!qtnCborReadValue(reader, id) || !qtnCborReadValue(reader, name))
+		{
+			ok = false;
+			break;
+		}
+
+		names.insert(QtnPropertyID(id), name);
+	}
+
+	return qtnCborLeaveContainer(reader) && ok;
+}
+
+bool QtnPropertySet::fromCbor(
+	const QByteArray &data, QtnPropertyChangeReason reason)
+{
+	QCborStreamReader reader(data);
+	bool ok = fromCbor(reader, reason);
+	return ok && reader.lastError() == QCborError::NoError;
+}
+
+bool QtnPropertySet::toCbor(QByteArray &data, bool withNames) const
+{
+	QCborStreamWriter writer(&data);
+	return toCbor(writer, withNames);
+}
+
+bool QtnPropertySet::toCbor(QCborStreamWriter &writer, bool withNames) const
+{
+	QList<QtnPropertyBase *> childProperties;
+	int namedCount = 0;
+	for (auto childProperty : m_childProperties)
+	{
+		if (childProperty->state() & QtnPropertyStateNonSerialized)
+			continue;
+
+		childProperties.append(childProperty);
+		if (childProperty->id() != QtnPropertyIDInvalid)
+			namedCount++;
+	}
+
+	withNames = withNames && namedCount > 0;
+	writer.startMap(quint64(childProperties.size() + (withNames ? 1 : 0)));
+
+	if (withNames)
+	{
+		// invalid id is never used as a key, so it marks the name table
+		writer.append(qint64(QtnPropertyIDInvalid));
+		writer.startMap(quint64(namedCount));
+		for (auto childProperty : childProperties)
+		{
+			if (childProperty->id() == QtnPropertyIDInvalid)
+				continue;
+
+			writer.append(qint64(childProperty->id()));
+			writer.append(childProperty->name());
+		}
+		writer.endMap();
+	}
+
+	bool ok = true;
+	for (auto childProperty : childProperties)
+	{
+		if (childProperty->id() == QtnPropertyIDInvalid)
+			writer.append(childProperty->name());
+		else
+			writer.append(qint64(childProperty->id()));
+
+		auto childPropertySet = childProperty->asPropertySet();
+		if (childPropertySet)
+		{
+			if (!childPropertySet->toCbor(writer, withNames))
+				ok = false;
+		} else if (!childProperty->toCbor(writer))
+		{
+			qDebug() << "Cannot convert property \"" << childProperty->name()
+					 << "\" to CBOR";
+			// keep the map consistent
+			writer.append(nullptr);
+			ok = false;
+		}
+	}
+
+	writer.endMap();
+	return ok;
+}
+
+bool QtnPropertySet::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	if (!reader.isMap())
+	{
+		reader.next();
+		return false;
+	}
+
+	if (!reader.enterContainer())
+		return false;
+
+	bool ok = true;
+	QHash<QtnPropertyID, QString> names;
+	while (reader.hasNext())
+	{
+		QtnPropertyBase *childProperty = nullptr;
+
+		qint64 id = QtnPropertyIDInvalid;
+		QString name;
+		if (qtnCborReadValue(reader, id))
+		{
+			if (id == QtnPropertyIDInvalid)
+			{
+				if (!qtnReadCborNames(reader, names))
+					ok = false;
+				continue;
+			}
+
+			childProperty = findChildProperty(QtnPropertyID(id));
+			if (!childProperty && names.contains(QtnPropertyID(id)))
+			{
+				childProperty =
+					qtnFindCborChild(this, names.value(QtnPropertyID(id)));
+			}
+		} else if (qtnCborReadValue(reader, name))
+		{
+			childProperty = qtnFindCborChild(this, name);
+		} else
+		{
+			qDebug() << "Cannot parse CBOR property key";
+			ok = false;
+			reader.next();
+		}
+
+		if (!childProperty ||
+			(childProperty->state() & QtnPropertyStateNonSerialized))
+		{
+			// cannot find subproperty or should not load it -> skip
+			reader.next();
+			continue;
+		}
+
+		if (!childProperty->fromCbor(reader, reason))
+		{
+			qDebug() << "Cannot load \"" << childProperty->name()
+					 << "\" from CBOR";
+			ok = false;
+		}
+	}
+
+	return qtnCborLeaveContainer(reader) && ok;
+}
+
+bool QtnPropertySet::toCborImpl(QCborStreamWriter &writer) const
+{
+	return toCbor(writer, false);
+}
+#endif
+
 bool QtnPropertySet::loadImpl(QDataStream &stream)
 {
 	if (!QtnPropertyBase::loadImpl(stream))
@@ -601,6 +936,20 @@ bool QtnPropertySet::saveImpl(QDataStream &stream) const
 	return stream.status() == QDataStream::Ok;
 }
 
+void QtnPropertySet::memoryUsageImpl(QtnMemoryUsage &usage) const
+{
+	QtnPropertyBase::memoryUsageImpl(usage);
+	usage.addProperty(metaObject()->className(),
+		qint64(sizeof(QtnPropertySet) - sizeof(QtnPropertyBase)) +
+			qint64(m_childProperties.size()) * qint64(sizeof(void *)),
+		0);
+
+	for (auto childProperty : m_childProperties)
+	{
+		childProperty->collectMemoryUsage(usage);
+	}
+}
+
 void QtnPropertySet::findChildPropertiesRecursive(
 	const QString &name, QList<QtnPropertyBase *> &result)
 {
@@ -646,17 +995,21 @@ bool QtnPropertySet::toStrWithPrefix(QString &str, const QString &prefix) const
 			if (!childProperty->toStr(strValue))
 				return false;
 
-			str.append(QStringLiteral("%1%2 = %3\n")
-						   .arg(prefix, childProperty->name(), strValue));
+			str += prefix;
+			str += childProperty->name();
+			str += QLatin1String(" = ");
+			str += strValue;
+			str += QChar::LineFeed;
 		} else
 		{
 			auto childPropertySet = childPropertyBase->asPropertySet();
 
 			if (childPropertySet)
 			{
-				if (!childPropertySet->toStrWithPrefix(str,
-						QStringLiteral("%1%2.").arg(
-							prefix, childPropertySet->name())))
+				QString childPrefix = prefix;
+				childPrefix += childPropertySet->name();
+				childPrefix += QLatin1Char('.');
+				if (!childPropertySet->toStrWithPrefix(str, childPrefix))
 					return false;
 			} else
 			{
@@ -20,6 +20,8 @@ limitations under the License.
 
 #include "Property.h"
 
+#include <QVector>
+
 class QJsonObject;
 
 class QTN_IMPORT_EXPORT QtnPropertySet : public QtnPropertyBase
@@ -64,6 +66,9 @@ public slots:
 	void clearChildProperties();
 	bool addChildProperty(QtnPropertyBase *childProperty,
 		bool moveOwnership = true, int index = -1);
+	// adds several properties emitting single change notification
+	bool addChildProperties(const QList<QtnPropertyBase *> &childProperties,
+		bool moveOwnership = true, int index = -1);
 	bool removeChildProperty(QtnPropertyBase *childProperty);
 
 	// cloning
@@ -80,6 +85,19 @@ public slots:
 	bool toJson(QJsonObject &jsonObject) const;
 
 public:
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR support
+	using QtnPropertyBase::fromCbor;
+	using QtnPropertyBase::toCbor;
+
+	bool fromCbor(const QByteArray &data,
+		QtnPropertyChangeReason reason = QtnPropertyChangeReasonChildren);
+	// Child properties are keyed by id, or by name if id is invalid.
+	// withNames adds id to name table of children to every property set map.
+	bool toCbor(QByteArray &data, bool withNames = false) const;
+	bool toCbor(QCborStreamWriter &writer, bool withNames) const;
+#endif
+
 	// casts
 	virtual QtnPropertySet *asPropertySet() override;
 	virtual const QtnPropertySet *asPropertySet() const override;
@@ -105,11 +123,21 @@ protected:
 		const QVariant &v, QtnPropertyChangeReason reason) override;
 	virtual bool toVariantImpl(QVariant &v) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	virtual bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	virtual bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	// serialization implementation
 	virtual bool loadImpl(QDataStream &stream) override;
 	virtual bool saveImpl(QDataStream &stream) const override;
 
+	virtual void memoryUsageImpl(QtnMemoryUsage &usage) const override;
+
 private:
+	void insertChildProperty(QtnPropertyBase *childProperty, int index);
+
 	void findChildPropertiesRecursive(
 		const QString &name, QList<QtnPropertyBase *> &result);
 	void findChildPropertiesRecursive(
@@ -168,4 +196,10 @@ QTN_IMPORT_EXPORT void qtnAddPropertyAsChild(
 QTN_IMPORT_EXPORT void qtnRemovePropertyAsChild(
 	QObject *parent, QtnPropertyBase *child);
 
+// Splits dot separated path the way findChildProperties matches it,
+// every segment is trimmed, so "a . b" is "a" and "b".
+// Returns false if any segment is empty.
+QTN_IMPORT_EXPORT bool qtnSplitPropertyPath(
+	const QStringRef &path, QVector<QStringRef> &segments);
+
 #endif // QTN_PROPERTY_SET_H
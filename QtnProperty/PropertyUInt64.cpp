@@ -22,6 +22,8 @@ limitations under the License.
 #include "Delegates/Utils/PropertyDelegateSliderBox.h"
 #include "Delegates/Utils/PropertyDelegateOpacityBox.h"
 #include "PropertyDelegateAttrs.h"
+#include "Auxiliary/PropertyCbor.h"
+#include "Auxiliary/PropertyNumber.h"
 
 #include <QLocale>
 #include <QKeyEvent>
@@ -35,10 +37,8 @@ QtnPropertyUInt64Base::QtnPropertyUInt64Base(QObject *parent)
 bool QtnPropertyUInt64Base::fromStrImpl(
 	const QString &str, QtnPropertyChangeReason reason)
 {
-	bool ok = false;
-	ValueType value = str.toULongLong(&ok);
-
-	if (!ok)
+	ValueType value = 0;
+	if (!qtnStrToNumber(str, value))
 		return false;
 
 	return setValue(value, reason);
@@ -46,9 +46,27 @@ bool QtnPropertyUInt64Base::fromStrImpl(
 
 bool QtnPropertyUInt64Base::toStrImpl(QString &str) const
 {
-	str = QString::number(value());
+	str = qtnNumberToStr(value());
+	return true;
+}
+
+#ifdef QTN_CBOR_SUPPORT
+bool QtnPropertyUInt64Base::fromCborImpl(
+	QCborStreamReader &reader, QtnPropertyChangeReason reason)
+{
+	quint64 value = 0;
+	if (!qtnCborReadValue(reader, value))
+		return QtnProperty::fromCborImpl(reader, reason);
+
+	return setValue(value, reason);
+}
+
+bool QtnPropertyUInt64Base::toCborImpl(QCborStreamWriter &writer) const
+{
+	writer.append(quint64(value()));
 	return true;
 }
+#endif
 
 bool QtnPropertyUInt64Base::fromVariantImpl(
 	const QVariant &var, QtnPropertyChangeReason reason)
@@ -91,6 +109,11 @@ void QtnPropertyDelegateUInt64::Register(QtnPropertyDelegateFactory &factory)
 		qtnOpacityBoxDelegate());
 }
 
+bool QtnPropertyDelegateUInt64::isShareable() const
+{
+	return true;
+}
+
 quint64 QtnPropertyDelegateUInt64::minValue() const
 {
 	return m_min.isValid() ? m_min.toULongLong() : owner().minValue();
@@ -179,9 +202,9 @@ bool QtnPropertyDelegateUInt64::propertyValueToStrImpl(QString &strValue) const
 void QtnPropertyDelegateUInt64::applyAttributesImpl(
 	const QtnPropertyDelegateInfo &info)
 {
-	info.loadAttribute(qtnSuffixAttr(), m_suffix);
-	m_min = info.attributes.value(qtnMinAttr());
-	m_max = info.attributes.value(qtnMaxAttr());
+	info.loadAttribute(QtnSuffixAttrId, m_suffix);
+	m_min = info.attributeValue(QtnMinAttrId);
+	m_max = info.attributeValue(QtnMaxAttrId);
 	fixMinMaxVariant<quint64>(m_min, m_max);
 }
 
@@ -36,6 +36,13 @@ protected:
 		const QString &str, QtnPropertyChangeReason reason) override;
 	virtual bool toStrImpl(QString &str) const override;
 
+#ifdef QTN_CBOR_SUPPORT
+	// CBOR conversion implementation
+	virtual bool fromCborImpl(
+		QCborStreamReader &reader, QtnPropertyChangeReason reason) override;
+	virtual bool toCborImpl(QCborStreamWriter &writer) const override;
+#endif
+
 	// variant conversion implementation
 	virtual bool fromVariantImpl(
 		const QVariant &var, QtnPropertyChangeReason reason) override;
@@ -92,6 +99,8 @@ public:
 
 	static void Register(QtnPropertyDelegateFactory &factory);
 
+	virtual bool isShareable() const override;
+
 	quint64 minValue() const;
 	quint64 maxValue() const;
 	quint64 currentValue() const;
@@ -19,6 +19,7 @@ limitations under the License.
 
 #include "Utils/InplaceEditing.h"
 #include "Utils/QtnConnections.h"
+#include "Utils/QtnSwatchCache.h"
 #include "Delegates/Utils/PropertyDelegateMisc.h"
 #include "QtnProperty/Core/PropertyBool.h"
 
@@ -28,25 +29,38 @@ limitations under the License.
 #include <QToolTip>
 #include <QStatusTipEvent>
 #include <functional>
+#include <algorithm>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QCryptographicHash>
+#include <QVarLengthArray>
+#include <QSet>
 
 struct QtnPropertyView::Item
 {
 	QtnPropertyBase *property;
-	std::unique_ptr<QtnPropertyDelegate> delegate;
+	std::shared_ptr<QtnPropertyDelegate> delegate;
 	int level;
 
 	Item *parent;
 	std::vector<std::unique_ptr<Item>> children;
 	QtnConnections connections;
 	bool wasCollapsed;
+	bool sharedDelegate;
+	// children exist only while expanded in any view
+	bool lazyChildren;
+	// addressed by name in the index as a property set child
+	bool pathIndexed;
+	QString indexedName;
+	ItemIndex *index;
 
 	Item();
+	~Item();
 
-	inline bool collapsed() const;
+	inline bool isBranch() const;
+
+	void collectMemoryUsage(QtnMemoryUsage &usage) const;
 };
 
 struct QtnPropertyView::VisibleItem
@@ -61,6 +75,169 @@ struct QtnPropertyView::VisibleItem
 	VisibleItem();
 };
 
+class QtnPropertyView::SharedDelegatePool
+{
+public:
+	using DelegatePtr = std::shared_ptr<QtnPropertyDelegate>;
+
+	// Returns shared delegate for property, creates and configures it
+	// when needed. Returns null if delegate cannot be shared.
+	DelegatePtr delegate(
+		QtnPropertyDelegateFactory &factory, QtnPropertyBase &property);
+
+	int count() const;
+
+private:
+	struct Key
+	{
+		const QMetaObject *metaObject;
+		QtnPropertyDelegateInfo info;
+
+		inline bool operator==(const Key &other) const
+		{
+			return metaObject == other.metaObject && info == other.info;
+		}
+
+		friend inline uint qHash(const Key &key, uint seed = 0)
+		{
+			return qHash(key.metaObject, seed) ^ qHash(key.info, seed);
+		}
+	};
+
+	struct Entry
+	{
+		std::weak_ptr<QtnPropertyDelegate> delegate;
+		bool shareable;
+	};
+
+	QHash<Key, Entry> m_entries;
+};
+
+// Items by property and property set children by name, so lookups
+// do not walk the tree. Items are added when created, renamed when
+// their property name changes and remove themselves when destroyed.
+class QtnPropertyView::ItemIndex
+{
+public:
+	void insert(Item *item);
+	void remove(Item *item);
+	void rename(Item *item);
+	void removeTree(Item *item);
+	// detaches items of the tree without removing them one by one
+	void clear(Item *root);
+
+	Item *find(const QtnPropertyBase *property) const;
+	// returns nullptr if path is not found or ambiguous
+	Item *findByPath(const QString &path) const;
+
+private:
+	void removeName(Item *item);
+	static void detach(Item *item);
+
+	QHash<const QtnPropertyBase *, Item *> m_byProperty;
+	QHash<QString, QVector<Item *>> m_byName;
+};
+
+// Item tree of a property set with delegates and property connections.
+// Several views may share one model, it notifies all of them
+// about property changes and rebuilds.
+class QtnPropertyView::ItemModel
+{
+public:
+	explicit ItemModel(QtnPropertyDelegateFactory *superFactory);
+	~ItemModel();
+
+	inline QtnPropertySet *propertySet() const;
+	void setPropertySet(QtnPropertySet *propertySet);
+
+	inline QtnPropertyDelegateFactory &delegateFactory();
+	inline Item *root() const;
+	inline const ItemIndex &index() const;
+	inline const QVector<QtnPropertyView *> &views() const;
+
+	bool sharedDelegates() const;
+	void setSharedDelegates(bool enabled);
+	int sharedDelegateCount() const;
+
+	void attach(QtnPropertyView *view);
+	void detach(QtnPropertyView *view);
+
+	void lockStructure(const QtnPropertyBase *property);
+	void unlockStructure(const QtnPropertyBase *property);
+	inline bool isStructureLocked() const;
+
+	void updateItemsTree();
+	// rebuilds outdated tree when no view is updating
+	void validateItemsTree();
+
+	void setupItemDelegate(Item *item, bool share = true);
+
+	void setBranchCollapsed(
+		QtnPropertyView *view, QtnPropertyBase *property, bool collapsed);
+	bool isCollapsedInAllViews(const QtnPropertyBase *property) const;
+
+private:
+	Item *createItemsTree(
+		QtnPropertyBase *rootProperty, Item *parent = nullptr);
+	void createItemChildren(Item *item);
+	void updateLazyItemChildren(Item *item);
+	void dropRemovedChildren(Item *item);
+	bool containsLockedProperty(const Item *item) const;
+	static void disconnectTree(Item *item);
+	static void invalidateViewItems(QtnPropertyView *view);
+	void forgetBranchStates(const Item *item);
+	void pruneBranchStates();
+
+	void onPropertyDidChange(QtnPropertyChangeReason reason, Item *item);
+	void onPropertySetDestroyed();
+
+	QtnPropertySet *m_propertySet;
+	QtnConnections m_propertySetConnections;
+	QtnPropertyDelegateFactory m_delegateFactory;
+	std::unique_ptr<SharedDelegatePool> m_sharedDelegates;
+
+	// declared before the tree, items remove themselves on destruction
+	ItemIndex m_itemIndex;
+	std::unique_ptr<Item> m_itemsTree;
+	// removed items with locked properties, kept until the rebuild
+	std::vector<std::unique_ptr<Item>> m_retiredItems;
+
+	QVector<QtnPropertyView *> m_views;
+	QVector<const QtnPropertyBase *> m_lockedProperties;
+	unsigned m_notifying;
+	bool m_treeOutdated;
+};
+
+QtnPropertySet *QtnPropertyView::ItemModel::propertySet() const
+{
+	return m_propertySet;
+}
+
+QtnPropertyDelegateFactory &QtnPropertyView::ItemModel::delegateFactory()
+{
+	return m_delegateFactory;
+}
+
+QtnPropertyView::Item *QtnPropertyView::ItemModel::root() const
+{
+	return m_itemsTree.get();
+}
+
+const QtnPropertyView::ItemIndex &QtnPropertyView::ItemModel::index() const
+{
+	return m_itemIndex;
+}
+
+const QVector<QtnPropertyView *> &QtnPropertyView::ItemModel::views() const
+{
+	return m_views;
+}
+
+bool QtnPropertyView::ItemModel::isStructureLocked() const
+{
+	return !m_lockedProperties.isEmpty();
+}
+
 class QtnPainterState
 {
 public:
@@ -75,9 +252,9 @@ extern void set_smaller_text_osx(QWidget *w);
 
 QtnPropertyView::QtnPropertyView(QWidget *parent, QtnPropertySet *propertySet)
 	: QAbstractScrollArea(parent)
-	, m_propertySet(propertySet)
 	, m_activeProperty(nullptr)
-	, m_delegateFactory(&QtnPropertyDelegateFactory::staticInstance())
+	, m_model(std::make_shared<ItemModel>(
+		  &QtnPropertyDelegateFactory::staticInstance()))
 	, m_visibleItemsValid(false)
 	, m_grabMouseSubItem(nullptr)
 	, m_style(QtnPropertyViewStyleLiveSplit)
@@ -99,12 +276,16 @@ QtnPropertyView::QtnPropertyView(QWidget *parent, QtnPropertySet *propertySet)
 
 	updateStyleStuff();
 
-	updateItemsTree();
+	m_model->attach(this);
+	m_model->setPropertySet(propertySet);
 }
 
 QtnPropertyView::~QtnPropertyView()
 {
-	// destruct everything
+	while (!m_structureLocks.isEmpty())
+		unlockStructure(m_structureLocks.last());
+
+	m_model->detach(this);
 }
 
 QtnAccessibilityProxy *QtnPropertyView::accessibilityProxy()
@@ -170,31 +351,80 @@ void QtnPropertyView::onEditedPropertyDidChange(QtnPropertyChangeReason reason)
 	}
 }
 
+QtnPropertyDelegateFactory *QtnPropertyView::delegateFactory()
+{
+	return &m_model->delegateFactory();
+}
+
+const QtnPropertySet *QtnPropertyView::propertySet() const
+{
+	return m_model->propertySet();
+}
+
+QtnPropertySet *QtnPropertyView::propertySet()
+{
+	return m_model->propertySet();
+}
+
 void QtnPropertyView::setPropertySet(QtnPropertySet *newPropertySet)
 {
-	if (newPropertySet == m_propertySet)
+	m_model->setPropertySet(newPropertySet);
+}
+
+void QtnPropertyView::shareItemsWith(QtnPropertyView *view)
+{
+	Q_ASSERT(view);
+	setItemModel(view->m_model);
+}
+
+void QtnPropertyView::unshareItems()
+{
+	if (m_model->views().size() <= 1)
 		return;
-	if (m_propertySet)
-	{
-		QObject::disconnect(m_propertySet, &QtnPropertyBase::destroyed, this,
-			&QtnPropertyView::onPropertySetDestroyed);
-	}
 
-	m_propertySet = newPropertySet;
+	auto model = std::make_shared<ItemModel>(
+		m_model->delegateFactory().superFactory());
+	model->setSharedDelegates(m_model->sharedDelegates());
 
-	if (m_propertySet)
-	{
-		QObject::connect(m_propertySet, &QtnPropertyBase::destroyed, this,
-			&QtnPropertyView::onPropertySetDestroyed);
-	}
+	auto propertySet = m_model->propertySet();
+	setItemModel(model);
+	model->setPropertySet(propertySet);
+}
 
-	updateItemsTree();
+bool QtnPropertyView::sharesItemsWith(const QtnPropertyView *view) const
+{
+	return view && view != this && view->m_model == m_model;
+}
+
+void QtnPropertyView::setItemModel(const std::shared_ptr<ItemModel> &model)
+{
+	if (model == m_model)
+		return;
+
+	// keep the old model alive until this view is detached
+	auto oldModel = m_model;
+	invalidateVisibleItems();
+	oldModel->detach(this);
+	for (auto property : m_structureLocks)
+		oldModel->unlockStructure(property);
+
+	// view joining existing items starts with branch states of properties
+	if (model->root())
+		m_branchStates.clear();
+
+	m_model = model;
+	for (auto property : m_structureLocks)
+		m_model->lockStructure(property);
+	m_model->attach(this);
+
+	if (m_activeProperty && !findItem(m_activeProperty))
+		setActivePropertyInternal(nullptr);
 }
 
 QtnPropertyBase *QtnPropertyView::getPropertyParent(
 	const QtnPropertyBase *property) const
 {
-	auto item = findItem(m_itemsTree.get(), property);
+	auto item = findItem(property);
 
 	if (nullptr != item && nullptr != item->parent)
 		return item->parent->property;
@@ -233,10 +463,11 @@ bool QtnPropertyView::setActiveProperty(int index, bool ensureVisible)
 	if (index < 0)
 		index = 0;
 
-	if (nullptr == m_propertySet)
+	auto propertySet = m_model->propertySet();
+	if (nullptr == propertySet)
 		return false;
 
-	auto &cp = m_propertySet->childProperties();
+	auto &cp = propertySet->childProperties();
 	if (cp.isEmpty())
 		return false;
 
@@ -255,16 +486,16 @@ bool QtnPropertyView::ensureVisible(const QtnPropertyBase *property)
 	if (index < 0)
 	{
 		// Expand ancestors so the property becomes visible
-		Item *item = findItem(m_itemsTree.get(), property);
+		Item *item = findItem(property);
 		if (!item)
 			return false;
 
 		m_restoringBranchState = true;
 		for (Item *p = item->parent; p; p = p->parent)
 		{
-			if (!p->children.empty() && p->property->isCollapsed())
+			if (p->isBranch() && isBranchCollapsed(p->property))
 			{
-				p->property->setCollapsed(false);
+				setBranchCollapsed(p->property, false);
 			}
 		}
 		m_restoringBranchState = false;
@@ -324,6 +555,12 @@ QtnPropertyBase *QtnPropertyView::getPropertyAt(
 	return nullptr;
 }
 
+QtnPropertyBase *QtnPropertyView::findProperty(const QString &nameOrPath) const
+{
+	auto item = m_model->index().findByPath(nameOrPath);
+	return item ? item->property : nullptr;
+}
+
 int QtnPropertyView::valueLeftMargin() const
 {
 	return m_valueLeftMargin;
@@ -353,6 +590,9 @@ void QtnPropertyView::paintEvent(QPaintEvent *e)
 	Q_UNUSED(e);
   
   QStylePainter painter(viewport());
+
+	m_textCache.setDevicePixelRatio(viewport()->devicePixelRatioF());
+	QtnPropertyTextCache::Scope textCacheScope(&m_textCache);
   
   if (m_propertySetBackdroundColor.isValid())
     painter.fillRect(rect(), m_propertySetBackdroundColor);
@@ -365,27 +605,26 @@ void QtnPropertyView::paintEvent(QPaintEvent *e)
 		return;
 	}
 
-	int firstVisibleItemIndex =
-		qMin(verticalScrollBar()->value() / m_itemHeight,
-			(m_visibleItems.size() - 1));
-	int lastVisibleItemIndex = qMin(
-		((verticalScrollBar()->value() + viewport()->height()) / m_itemHeight) +
-			1,
-		(m_visibleItems.size() - 1));
+	int scrollPos = verticalScrollBar()->value();
+	int firstVisibleItemIndex = m_rowLayout.rowAt(scrollPos);
+	if (firstVisibleItemIndex < 0)
+		firstVisibleItemIndex = m_visibleItems.size() - 1;
 
 	auto viewPortRect = viewport()->rect();
 	QRect itemRect = viewPortRect;
-	itemRect.setTop(
-		firstVisibleItemIndex * m_itemHeight - verticalScrollBar()->value());
-	itemRect.setBottom(itemRect.top() + m_itemHeight);
+	int itemTop = m_rowLayout.top(firstVisibleItemIndex) - scrollPos;
 
 	QPen splitterPen;
 	splitterPen.setColor(this->palette().color(QPalette::Mid));
 	splitterPen.setStyle(Qt::DotLine);
 
-	for (int i = firstVisibleItemIndex; i <= lastVisibleItemIndex; ++i)
+	for (int i = firstVisibleItemIndex, n = m_visibleItems.size();
+		 i < n && itemTop <= viewPortRect.bottom(); ++i)
 	{
 		const VisibleItem &vItem = m_visibleItems[i];
+		int itemHeight = m_rowLayout.height(i);
+		itemRect.setTop(itemTop);
+		itemRect.setBottom(itemTop + itemHeight);
 		
 		if (m_alternatingRowColors && (i & 1))
 			painter.fillRect(itemRect, m_propertyAlternativeBackgroundColor);
@@ -403,22 +642,15 @@ void QtnPropertyView::paintEvent(QPaintEvent *e)
 				itemRect.bottom());
 			painter.restore();
 		}
-		itemRect.translate(0, m_itemHeight);
+		itemTop += itemHeight;
 	}
 }
 
 void QtnPropertyView::drawItem(
 	QStylePainter &painter, const QRect &rect, const VisibleItem &vItem) const
 {
-	auto delegate = vItem.item->delegate.get();
-	Q_ASSERT(delegate); // cannot be null
-
-	QMargins margins(m_valueLeftMargin + rect.height() * vItem.level, 0, 0, 0);
-	bool isActive = (m_activeProperty == vItem.item->property);
-
-	QtnDrawContext drawContext{ &painter, this, rect, margins, splitPosition(),
-		isActive, vItem.hasChildren, m_isDarkMode };
-	drawContext.colorCallback = m_colorCallback;
+	auto delegate = itemDelegate(vItem.item);
+	auto drawContext = itemDrawContext(&painter, rect, vItem);
 
 	// create sub-items if not initialized
 	if (!vItem.subItemsValid)
@@ -435,6 +667,21 @@ void QtnPropertyView::drawItem(
 	}
 }
 
+QtnDrawContext QtnPropertyView::itemDrawContext(
+	QStylePainter *painter, const QRect &rect, const VisibleItem &vItem) const
+{
+	// indentation does not depend on row height,
+	// default rows are painted one pixel taller than item height
+	QMargins margins(
+		m_valueLeftMargin + (m_itemHeight + 1) * vItem.level, 0, 0, 0);
+	bool isActive = (m_activeProperty == vItem.item->property);
+
+	QtnDrawContext drawContext{ painter, this, rect, margins, splitPosition(),
+		isActive, vItem.hasChildren, m_isDarkMode };
+	drawContext.colorCallback = m_colorCallback;
+	return drawContext;
+}
+
 void QtnPropertyView::changeActivePropertyByIndex(int index)
 {
 	QtnPropertyBase *newActiveProperty =
@@ -456,11 +703,7 @@ QtnPropertyBase *QtnPropertyView::visiblePropertyAtPoint(
 
 int QtnPropertyView::visibleItemIndexByPoint(const QPoint &pos) const
 {
-	int index = (verticalScrollBar()->value() + pos.y()) / m_itemHeight;
-	if (index >= m_visibleItems.size())
-		return -1;
-
-	return index;
+	return m_rowLayout.rowAt(verticalScrollBar()->value() + pos.y());
 }
 
 int QtnPropertyView::visibleItemIndexByProperty(
@@ -468,11 +711,11 @@ int QtnPropertyView::visibleItemIndexByProperty(
 {
 	validateVisibleItems();
 
-	for (int i = 0, n = m_visibleItems.size(); i < n; ++i)
-		if (m_visibleItems[i].item->property == property)
-			return i;
+	auto item = findItem(property);
+	if (!item)
+		return -1;
 
-	return -1;
+	return m_visibleIndexes.value(item, -1);
 }
 
 QRect QtnPropertyView::itemRect(const QtnPropertyBase *property) const
@@ -488,8 +731,8 @@ QRect QtnPropertyView::visibleItemRect(int index) const
 	Q_ASSERT(index >= 0 && index < m_visibleItems.size());
 
 	QRect rect = viewport()->rect();
-	rect.setTop(index * m_itemHeight - verticalScrollBar()->value());
-	rect.setHeight(m_itemHeight);
+	rect.setTop(m_rowLayout.top(index) - verticalScrollBar()->value());
+	rect.setHeight(m_rowLayout.height(index));
 
 	return rect;
 }
@@ -518,16 +761,99 @@ QRect QtnPropertyView::propertyActionRect(
 
 bool QtnPropertyView::handleMouseEvent(int index, QEvent *e, QPoint mousePos)
 {
-	if (index < 0)
+	m_hoverRect = QRect();
+
+	if (index < 0 || index >= m_visibleItems.size())
 	{
 		deactivateSubItems();
 		return false;
 	}
 
+	// rows are painted with sub-items, but the row under cursor
+	// may be not painted yet after invalidation
+	validateSubItems(index);
+
+	switch (e->type())
+	{
+		case QEvent::MouseButtonPress:
+		case QEvent::MouseButtonDblClick:
+			unshareItemDelegate(index);
+			break;
+
+		default:
+			break;
+	}
+
 	QtnEventContext context{ e, this };
 	return handleEvent(context, m_visibleItems[index], mousePos);
 }
 
+void QtnPropertyView::validateSubItems(int index)
+{
+	auto &vItem = m_visibleItems[index];
+	if (vItem.subItemsValid)
+		return;
+
+	Q_ASSERT(vItem.subItems.isEmpty());
+
+	// same row rect as in paintEvent
+	auto rect = visibleItemRect(index);
+	rect.setBottom(rect.top() + m_rowLayout.height(index));
+
+	auto drawContext = itemDrawContext(nullptr, rect, vItem);
+	itemDelegate(vItem.item)->createSubItems(drawContext, vItem.subItems);
+	vItem.subItemsValid = true;
+}
+
+static const int TOLERANCE = 3;
+
+QRect QtnPropertyView::hoverCellRect(int index, const QPoint &pos) const
+{
+	// event handlers may invalidate visible items
+	if (index < 0 || index >= m_visibleItems.size())
+		return QRect();
+
+	auto &vItem = m_visibleItems[index];
+	if (!vItem.subItemsValid)
+		return QRect();
+
+	// splitter cursor area is not cached
+	QRect cell = visibleItemRect(index);
+	int split = splitPosition();
+	if (pos.x() <= split - TOLERANCE)
+		cell.setRight(qMin(cell.right(), split - TOLERANCE));
+	else if (pos.x() >= split + TOLERANCE)
+		cell.setLeft(qMax(cell.left(), split + TOLERANCE));
+	else
+		return QRect();
+
+	for (auto &subItem : vItem.subItems)
+	{
+		if (subItem.rect.contains(pos))
+			cell &= subItem.rect;
+	}
+
+	// cut off sub-items not under cursor
+	for (auto &subItem : vItem.subItems)
+	{
+		auto &rect = subItem.rect;
+		if (rect.contains(pos) || !rect.intersects(cell))
+			continue;
+
+		if (rect.right() < pos.x())
+			cell.setLeft(rect.right() + 1);
+		else if (rect.left() > pos.x())
+			cell.setRight(rect.left() - 1);
+		else if (rect.bottom() < pos.y())
+			cell.setTop(rect.bottom() + 1);
+		else
+			cell.setBottom(rect.top() - 1);
+	}
+
+	Q_ASSERT(cell.contains(pos));
+	return cell;
+}
+
 void QtnPropertyView::resizeEvent(QResizeEvent *e)
 {
 	Q_UNUSED(e);
@@ -537,8 +863,6 @@ void QtnPropertyView::resizeEvent(QResizeEvent *e)
 	updateVScrollbar();
 }
 
-static const int TOLERANCE = 3;
-
 void QtnPropertyView::mousePressEvent(QMouseEvent *e)
 {
 	m_mouseCaptured = false;
@@ -657,7 +981,8 @@ void QtnPropertyView::mouseMoveEvent(QMouseEvent *e)
 					(float) (e->x() - rect.left()) / (float) rect.width());
 			}
 		}
-	} else
+	} else if (e->buttons() != Qt::NoButton || m_grabMouseSubItem ||
+		!m_hoverRect.contains(e->pos()))
 	{
 		int index = visibleItemIndexByPoint(e->pos());
 		bool isSplittable = index >= 0
@@ -687,6 +1012,9 @@ void QtnPropertyView::mouseMoveEvent(QMouseEvent *e)
 
 		// emit status tip when hovered property changes
 		updateHoveredStatusTip(getPropertyAt(e->pos()));
+
+		if (e->buttons() == Qt::NoButton && !m_grabMouseSubItem)
+			m_hoverRect = hoverCellRect(index, e->pos());
 	}
 	QAbstractScrollArea::mouseMoveEvent(e);
 }
@@ -705,9 +1033,19 @@ bool QtnPropertyView::viewportEvent(QEvent *e)
 	switch (e->type())
 	{
 		case QEvent::StyleChange:
+			m_textCache.clear();
+			QtnSwatchCache::clear();
 			updateStyleStuff();
 			break;
 
+		case QEvent::PaletteChange:
+			QtnSwatchCache::clear();
+			break;
+
+		case QEvent::FontChange:
+			m_textCache.clear();
+			break;
+
 		case QEvent::ToolTip:
 		{
 			QHelpEvent *helpEvent = static_cast<QHelpEvent *>(e);
@@ -811,9 +1149,11 @@ void QtnPropertyView::keyPressEvent(QKeyEvent *e)
 				changeActivePropertyByIndex(0);
 			else
 			{
-				int itemsPerPage =
-					qMax(viewport()->rect().height() / m_itemHeight, 1);
-				changeActivePropertyByIndex(qMax(0, index - itemsPerPage));
+				int pageTop =
+					m_rowLayout.top(index) - viewport()->rect().height();
+				int pageIndex = m_rowLayout.rowAt(qMax(0, pageTop));
+				changeActivePropertyByIndex(
+					qMax(0, qMin(pageIndex, index - 1)));
 			}
 			break;
 		}
@@ -826,10 +1166,13 @@ void QtnPropertyView::keyPressEvent(QKeyEvent *e)
 				changeActivePropertyByIndex(0);
 			else
 			{
-				int itemsPerPage =
-					qMax(viewport()->rect().height() / m_itemHeight, 1);
+				int lastIndex = m_visibleItems.size() - 1;
+				int pageIndex = m_rowLayout.rowAt(
+					m_rowLayout.top(index) + viewport()->rect().height());
+				if (pageIndex < 0)
+					pageIndex = lastIndex;
 				changeActivePropertyByIndex(
-					qMin(m_visibleItems.size() - 1, index + itemsPerPage));
+					qMin(lastIndex, qMax(pageIndex, index + 1)));
 			}
 			break;
 		}
@@ -843,10 +1186,11 @@ void QtnPropertyView::keyPressEvent(QKeyEvent *e)
 			else
 			{
 				const VisibleItem &vItem = m_visibleItems[index];
-				if (vItem.hasChildren && !vItem.item->collapsed())
+				if (vItem.hasChildren &&
+					!isBranchCollapsed(vItem.item->property))
 				{
 					// collapse opened property
-					vItem.item->property->addState(QtnPropertyStateCollapsed);
+					setBranchCollapsed(vItem.item->property, true);
 				} else if (vItem.item->parent)
 				{
 					// activate parent property
@@ -865,11 +1209,11 @@ void QtnPropertyView::keyPressEvent(QKeyEvent *e)
 			else
 			{
 				const VisibleItem &vItem = m_visibleItems[index];
-				if (vItem.hasChildren && vItem.item->collapsed())
+				if (vItem.hasChildren &&
+					isBranchCollapsed(vItem.item->property))
 				{
 					// expand closed property
-					vItem.item->property->removeState(
-						QtnPropertyStateCollapsed);
+					setBranchCollapsed(vItem.item->property, false);
 				} else if (vItem.hasChildren)
 				{
 					// activate child property
@@ -886,6 +1230,8 @@ void QtnPropertyView::keyPressEvent(QKeyEvent *e)
 
 			if (index >= 0)
 			{
+				unshareItemDelegate(index);
+
 				QtnEventContext context{ e, this };
 				if (handleEvent(context, m_visibleItems[index], QPoint()))
 				{
@@ -953,6 +1299,53 @@ void QtnPropertyView::updateHoveredStatusTip(QtnPropertyBase *hovered)
 	QCoreApplication::sendEvent(this, &ev);
 }
 
+bool QtnPropertyView::sharedDelegates() const
+{
+	return m_model->sharedDelegates();
+}
+
+void QtnPropertyView::setSharedDelegates(bool enabled)
+{
+	m_model->setSharedDelegates(enabled);
+}
+
+void QtnPropertyView::beginUpdate()
+{
+	if (0 == m_stopInvalidate++)
+		m_lastChangeReason = QtnPropertyChangeReason(0);
+}
+
+void QtnPropertyView::endUpdate()
+{
+	Q_ASSERT(m_stopInvalidate > 0);
+
+	if (--m_stopInvalidate == 0)
+	{
+		updateWithReason(m_lastChangeReason);
+		// rebuild may be deferred by this view for other views too
+		m_model->validateItemsTree();
+	}
+}
+
+void QtnPropertyView::lockStructure(const QtnPropertyBase *property)
+{
+	m_structureLocks.append(property);
+	m_model->lockStructure(property);
+}
+
+void QtnPropertyView::unlockStructure(const QtnPropertyBase *property)
+{
+	bool removed = m_structureLocks.removeOne(property);
+	Q_ASSERT(removed);
+	if (removed)
+		m_model->unlockStructure(property);
+}
+
+bool QtnPropertyView::isStructureLocked() const
+{
+	return m_model->isStructureLocked();
+}
+
 bool QtnPropertyView::handleEvent(
 	QtnEventContext &context, VisibleItem &vItem, QPoint mousePos)
 {
@@ -970,6 +1363,7 @@ bool QtnPropertyView::handleEvent(
 		result = false;
 		// update list of sub items under cursor
 		QList<QtnSubItem *> activeSubItems;
+		itemDelegate(vItem.item);
 
 		// make list of new active sub items
 		for (auto &subItem : vItem.subItems)
@@ -982,6 +1376,9 @@ bool QtnPropertyView::handleEvent(
 		}
 
 		// deactivate old sub items
+		if (m_activeSubItemsItem)
+			itemDelegate(m_activeSubItemsItem);
+
 		for (auto activeSubItem : m_activeSubItems)
 		{
 			activeSubItem->deactivate(this, mousePos);
@@ -989,6 +1386,9 @@ bool QtnPropertyView::handleEvent(
 
 		// adopt new active sub items
 		m_activeSubItems.swap(activeSubItems);
+		m_activeSubItemsItem =
+			m_activeSubItems.isEmpty() ? nullptr : vItem.item;
+		itemDelegate(vItem.item);
 
 		// process event
 		for (auto activeSubItem : m_activeSubItems)
@@ -1001,7 +1401,10 @@ bool QtnPropertyView::handleEvent(
 		}
 	}
 	if (--m_stopInvalidate == 0)
+	{
 		updateWithReason(m_lastChangeReason);
+		m_model->validateItemsTree();
+	}
 
 	return result;
 }
@@ -1011,12 +1414,75 @@ QtnPropertyView::Item::Item()
 	, level(0)
 	, parent(nullptr)
 	, wasCollapsed(false)
+	, sharedDelegate(false)
+	, lazyChildren(false)
+	, pathIndexed(false)
+	, index(nullptr)
 {
 }
 
-bool QtnPropertyView::Item::collapsed() const
+QtnPropertyView::Item::~Item()
 {
-	return property->isCollapsed();
+	if (index)
+		index->remove(this);
+}
+
+bool QtnPropertyView::Item::isBranch() const
+{
+	return lazyChildren || !children.empty();
+}
+
+void QtnPropertyView::Item::collectMemoryUsage(QtnMemoryUsage &usage) const
+{
+	usage.add(QtnMemoryUsage::ViewItems,
+		qint64(sizeof(Item)) +
+			qint64(children.capacity()) *
+				qint64(sizeof(std::unique_ptr<Item>)));
+
+	// actual delegate classes are not known here,
+	// shared delegates are reported by the view
+	if (delegate && !sharedDelegate)
+		usage.add(QtnMemoryUsage::Delegates, sizeof(QtnPropertyDelegate));
+
+	usage.add(QtnMemoryUsage::Connections,
+		qint64(connections.capacity()) *
+			qint64(sizeof(QMetaObject::Connection)),
+		qint64(connections.size()));
+
+	for (auto &child : children)
+	{
+		child->collectMemoryUsage(usage);
+	}
+}
+
+QtnMemoryUsage QtnPropertyView::memoryUsage() const
+{
+	QtnMemoryUsage usage;
+
+	auto root = m_model->root();
+	if (root)
+		root->collectMemoryUsage(usage);
+
+	for (auto &vItem : m_visibleItems)
+	{
+		usage.add(QtnMemoryUsage::ViewItems, sizeof(VisibleItem));
+		usage.add(QtnMemoryUsage::SubItems,
+			qint64(vItem.subItems.size()) * qint64(sizeof(QtnSubItem)),
+			vItem.subItems.size());
+	}
+
+	usage.add(QtnMemoryUsage::SubItems,
+		qint64(m_activeSubItems.size()) * qint64(sizeof(QtnSubItem *)), 0);
+
+	int count = m_model->sharedDelegateCount();
+	if (count > 0)
+	{
+		usage.add(QtnMemoryUsage::Delegates,
+			qint64(count) * qint64(sizeof(QtnPropertyDelegate)), count);
+	}
+	usage.addString(m_lastStatusTip);
+
+	return usage;
 }
 
 bool QtnPropertyView::grabMouseForSubItem(QtnSubItem *subItem, QPoint mousePos)
@@ -1047,33 +1513,6 @@ bool QtnPropertyView::releaseMouseForSubItem(
 	return true;
 }
 
-void QtnPropertyView::updateItemsTree()
-{
-	m_itemsTree.reset(createItemsTree(m_propertySet));
-	invalidateVisibleItems();
-}
-
-QtnPropertyView::Item *QtnPropertyView::createItemsTree(
-	QtnPropertyBase *rootProperty)
-{
-	if (!rootProperty)
-		return nullptr;
-
-	auto item = new Item;
-	item->property = rootProperty;
-	auto &connections = item->connections;
-
-	connections.push_back(
-		QObject::connect(rootProperty, &QtnPropertyBase::propertyDidChange,
-			this, [item, this](QtnPropertyChangeReason reason) {
-				onPropertyDidChange(reason, item);
-			}));
-
-	setupItemDelegate(item);
-
-	return item;
-}
-
 void QtnPropertyView::setActivePropertyInternal(QtnPropertyBase *property)
 {
 	disconnectActiveProperty();
@@ -1090,6 +1529,8 @@ void QtnPropertyView::invalidateVisibleItems()
 	deactivateSubItems();
 	m_visibleItemsValid = false;
 	m_visibleItems.clear();
+	m_visibleIndexes.clear();
+	m_rowLayout.clear();
 	viewport()->update();
 }
 
@@ -1099,7 +1540,18 @@ void QtnPropertyView::validateVisibleItems() const
 		return;
 
 	fillVisibleItems(
-		m_itemsTree.get(), (m_style & QtnPropertyViewStyleShowRoot) ? 0 : -1);
+		m_model->root(), (m_style & QtnPropertyViewStyleShowRoot) ? 0 : -1);
+
+	QVector<int> heights;
+	heights.reserve(m_visibleItems.size());
+	m_visibleIndexes.reserve(m_visibleItems.size());
+	for (int i = 0, n = m_visibleItems.size(); i < n; ++i)
+	{
+		auto item = m_visibleItems[i].item;
+		m_visibleIndexes.insert(item, i);
+		heights.append(itemRowHeight(item));
+	}
+	m_rowLayout.reset(heights);
 
 	updateVScrollbar();
 
@@ -1131,8 +1583,11 @@ void QtnPropertyView::fillVisibleItems(Item *item, int level) const
 	vItem.item = item;
 	vItem.level = level;
 
-	if (item->collapsed())
+	if (isBranchCollapsed(item->property))
 	{
+		// lazy children are not created until expanded
+		vItem.hasChildren = item->lazyChildren;
+
 		// check if item has any child
 		for (auto &child : item->children)
 		{
@@ -1173,7 +1628,7 @@ bool QtnPropertyView::acceptItem(const Item &item) const
 void QtnPropertyView::updateVScrollbar() const
 {
 	int viewportHeight = viewport()->height();
-	int virtualHeight = m_itemHeight * m_visibleItems.size();
+	int virtualHeight = m_rowLayout.totalHeight();
 
 	verticalScrollBar()->setSingleStep(m_itemHeight);
 	verticalScrollBar()->setPageStep(viewportHeight);
@@ -1184,7 +1639,14 @@ void QtnPropertyView::updateVScrollbar() const
 void QtnPropertyView::updateStyleStuff()
 {
 	QFontMetrics fm(font());
-	m_itemHeight = fm.height() + m_itemHeightSpacing;
+	int itemHeight = fm.height() + m_itemHeightSpacing;
+	if (itemHeight != m_itemHeight)
+	{
+		m_itemHeight = itemHeight;
+		// row heights of delegates depend on default height
+		invalidateVisibleItems();
+	}
+	m_hoverRect = QRect();
 
 	m_propertyAlternativeBackgroundColor = palette().color(QPalette::AlternateBase); 
 	
@@ -1193,11 +1655,11 @@ void QtnPropertyView::updateStyleStuff()
 
 bool QtnPropertyView::ensureVisibleItemByIndex(int index)
 {
-	if (index < 0)
+	if (index < 0 || index >= m_rowLayout.count())
 		return false;
 
-	int vItemTop = index * m_itemHeight - 4;
-	int vItemBottom = vItemTop + m_itemHeight + 4;
+	int vItemTop = m_rowLayout.top(index) - 4;
+	int vItemBottom = vItemTop + m_rowLayout.height(index) + 4;
 
 	QRect rect = viewport()->rect();
 	int scrollPos = verticalScrollBar()->value();
@@ -1232,10 +1694,15 @@ void QtnPropertyView::deactivateSubItems()
 		m_grabMouseSubItem = nullptr;
 	}
 
+	if (m_activeSubItemsItem)
+		itemDelegate(m_activeSubItemsItem);
+
 	for (auto subItem : m_activeSubItems)
 		subItem->deactivate(this, QPoint());
 
 	m_activeSubItems.clear();
+	m_activeSubItemsItem = nullptr;
+	m_hoverRect = QRect();
 
 	QToolTip::hideText();
 }
@@ -1272,68 +1739,472 @@ void QtnPropertyView::disconnectActiveProperty()
 	}
 }
 
-void QtnPropertyView::onPropertyDidChange(
-	QtnPropertyChangeReason reason, Item *item)
+void QtnPropertyView::onPropertyDidChange(QtnPropertyChangeReason reason,
+	QtnPropertyChangeReason viewReason, Item *item, bool branchToggled)
 {
-	if (!reason)
-		return;
-
-	if (reason & QtnPropertyChangeReasonUpdateDelegate)
+	if ((viewReason & QtnPropertyChangeReasonValue) && item)
 	{
-		setupItemDelegate(item);
+		// delegate may size row by its value
+		updateItemRowHeight(item);
 	}
 
 	if (m_stopInvalidate)
 	{
-		m_lastChangeReason |= reason;
+		m_lastChangeReason |= viewReason;
 	} else
 	{
-		updateWithReason(reason);
+		updateWithReason(viewReason);
 	}
 
-	if ((reason & QtnPropertyChangeReasonState) && item && !m_restoringBranchState)
+	// views keeping their own state of the branch are not toggled
+	if (branchToggled && !m_restoringBranchState &&
+		!m_branchStates.contains(item->property))
 	{
-		bool collapsedNow = item->property->isCollapsed();
-		bool hasChildren = !item->children.empty();
-		if (hasChildren && collapsedNow != item->wasCollapsed)
-		{
-			item->wasCollapsed = collapsedNow;
-			emit branchExpandedStateChanged(item->property, collapsedNow);
-		}
+		emit branchExpandedStateChanged(
+			item->property, item->property->isCollapsed());
 	}
 
 	emit propertiesChanged(reason);
 }
 
 QtnPropertyView::Item *QtnPropertyView::findItem(
-	Item *currentItem, const QtnPropertyBase *property) const
+	const QtnPropertyBase *property) const
+{
+	return m_model->index().find(property);
+}
+
+QtnPropertyDelegate *QtnPropertyView::itemDelegate(const Item *item) const
+{
+	auto delegate = item->delegate.get();
+	Q_ASSERT(delegate); // cannot be null
+
+	if (item->sharedDelegate)
+		delegate->bindProperty(*item->property);
+
+	return delegate;
+}
+
+int QtnPropertyView::itemRowHeight(const Item *item) const
+{
+	return qMax(1, itemDelegate(item)->rowHeight(m_itemHeight));
+}
+
+void QtnPropertyView::updateItemRowHeight(Item *item)
+{
+	if (!m_visibleItemsValid)
+		return;
+
+	int index = m_visibleIndexes.value(item, -1);
+	if (index < 0)
+		return;
+
+	int height = itemRowHeight(item);
+	if (height == m_rowLayout.height(index))
+		return;
+
+	m_rowLayout.setHeight(index, height);
+
+	// rows below are moved
+	invalidateSubItems();
+	m_hoverRect = QRect();
+	updateVScrollbar();
+	viewport()->update();
+}
+
+void QtnPropertyView::unshareItemDelegate(int index)
+{
+	auto &vItem = m_visibleItems[index];
+	auto item = vItem.item;
+	if (!item->sharedDelegate)
+		return;
+
+	// in-place editors keep their delegate,
+	// so the row gets a delegate of its own before editing
+	m_model->setupItemDelegate(item, false);
+
+	// sub-items of other views may refer to the released delegate
+	for (auto view : m_model->views())
+	{
+		if (view != this)
+		{
+			view->invalidateSubItems();
+			view->viewport()->update();
+		}
+	}
+
+	if (vItem.subItemsValid)
+	{
+		// same row rect as in paintEvent
+		auto rect = visibleItemRect(index);
+		rect.setBottom(rect.top() + m_rowLayout.height(index));
+
+		auto drawContext = itemDrawContext(nullptr, rect, vItem);
+		vItem.subItems.clear();
+		item->delegate->createSubItems(drawContext, vItem.subItems);
+	}
+}
+
+QtnPropertyView::SharedDelegatePool::DelegatePtr
+QtnPropertyView::SharedDelegatePool::delegate(
+	QtnPropertyDelegateFactory &factory, QtnPropertyBase &property)
+{
+	Key key;
+	key.metaObject = property.metaObject();
+	auto delegateInfo = property.delegateInfo();
+	if (delegateInfo)
+		key.info = *delegateInfo;
+
+	auto it = m_entries.find(key);
+	if (it != m_entries.end())
+	{
+		if (!it->shareable)
+			return nullptr;
+
+		auto result = it->delegate.lock();
+		if (result)
+			return result;
+	}
+
+	DelegatePtr result(factory.createDelegate(property));
+	Q_ASSERT(result); // should always return non-null
+
+	bool shareable = result->isShareable();
+	if (shareable)
+	{
+		if (delegateInfo)
+			result->applyAttributes(*delegateInfo);
+
+		// sub-properties are owned by delegate, so they cannot be shared
+		shareable = (result->subPropertyCount() == 0);
+	}
+
+	if (!shareable)
+		result.reset();
+
+	m_entries.insert(key, Entry{ result, shareable });
+	return result;
+}
+
+int QtnPropertyView::SharedDelegatePool::count() const
+{
+	int result = 0;
+	for (auto &entry : m_entries)
+	{
+		if (!entry.delegate.expired())
+			result++;
+	}
+
+	return result;
+}
+
+void QtnPropertyView::ItemIndex::insert(Item *item)
+{
+	Q_ASSERT(!item->index);
+	item->index = this;
+
+	// a property is found by its first item
+	if (!m_byProperty.contains(item->property))
+		m_byProperty.insert(item->property, item);
+
+	// only properties reachable through property sets have paths
+	auto parent = item->parent;
+	item->pathIndexed = parent && parent->property->asPropertySet() &&
+		(!parent->parent || parent->pathIndexed);
+
+	if (item->pathIndexed)
+	{
+		item->indexedName = item->property->name();
+		m_byName[item->indexedName].append(item);
+	}
+}
+
+void QtnPropertyView::ItemIndex::remove(Item *item)
+{
+	Q_ASSERT(item->index == this);
+	item->index = nullptr;
+
+	auto it = m_byProperty.find(item->property);
+	if (it != m_byProperty.end() && it.value() == item)
+		m_byProperty.erase(it);
+
+	if (item->pathIndexed)
+		removeName(item);
+}
+
+void QtnPropertyView::ItemIndex::rename(Item *item)
+{
+	if (!item->pathIndexed || item->indexedName == item->property->name())
+		return;
+
+	removeName(item);
+	item->indexedName = item->property->name();
+	m_byName[item->indexedName].append(item);
+}
+
+void QtnPropertyView::ItemIndex::removeTree(Item *item)
+{
+	if (item->index == this)
+		remove(item);
+
+	for (auto &child : item->children)
+		removeTree(child.get());
+}
+
+void QtnPropertyView::ItemIndex::clear(Item *root)
+{
+	if (root)
+		detach(root);
+
+	m_byProperty.clear();
+	m_byName.clear();
+}
+
+QtnPropertyView::Item *QtnPropertyView::ItemIndex::find(
+	const QtnPropertyBase *property) const
+{
+	return m_byProperty.value(property);
+}
+
+QtnPropertyView::Item *QtnPropertyView::ItemIndex::findByPath(
+	const QString &path) const
 {
-	if (nullptr != currentItem && nullptr != property)
+	QVector<QStringRef> segments;
+	if (!qtnSplitPropertyPath(QStringRef(&path), segments))
+		return nullptr;
+
+	auto it = m_byName.constFind(segments.last().toString());
+	if (it == m_byName.constEnd())
+		return nullptr;
+
+	// Head segments match ancestors in order, but not necessarily
+	// adjacent ones. Path is ambiguous if there is more than one chain.
+	int headCount = segments.size() - 1;
+	Item *result = nullptr;
+	int chains = 0;
+	QVarLengthArray<Item *, 16> ancestors;
+	QVarLengthArray<int, 16> ways;
+	for (auto item : it.value())
 	{
-		if (property == currentItem->property)
-			return currentItem;
+		ancestors.clear();
+		for (auto parent = item->parent; parent && parent->pathIndexed;
+			 parent = parent->parent)
+		{
+			ancestors.append(parent);
+		}
+
+		// ways[i] is number of chains matching first i head segments
+		ways.resize(headCount + 1);
+		std::fill(ways.begin(), ways.end(), 0);
+		ways[0] = 1;
+		for (int a = ancestors.size() - 1; a >= 0; a--)
+		{
+			auto &name = ancestors.at(a)->indexedName;
+			for (int i = headCount; i > 0; i--)
+			{
+				if (name == segments.at(i - 1))
+					ways[i] += ways[i - 1];
+			}
+		}
 
-		for (auto &item : currentItem->children)
+		if (ways[headCount] > 0)
 		{
-			auto found = findItem(item.get(), property);
+			chains += ways[headCount];
+			if (chains > 1)
+				return nullptr;
 
-			if (nullptr != found)
-				return found;
+			result = item;
 		}
 	}
 
-	return nullptr;
+	return result;
+}
+
+void QtnPropertyView::ItemIndex::removeName(Item *item)
+{
+	auto it = m_byName.find(item->indexedName);
+	if (it == m_byName.end())
+		return;
+
+	it.value().removeOne(item);
+	if (it.value().isEmpty())
+		m_byName.erase(it);
+}
+
+void QtnPropertyView::ItemIndex::detach(Item *item)
+{
+	item->index = nullptr;
+	for (auto &child : item->children)
+		detach(child.get());
 }
 
-void QtnPropertyView::setupItemDelegate(Item *item)
+QtnPropertyView::ItemModel::ItemModel(
+	QtnPropertyDelegateFactory *superFactory)
+	: m_propertySet(nullptr)
+	, m_delegateFactory(superFactory)
+	, m_notifying(0)
+	, m_treeOutdated(false)
 {
+}
+
+QtnPropertyView::ItemModel::~ItemModel()
+{
+	Q_ASSERT(m_views.isEmpty());
+	m_itemIndex.clear(m_itemsTree.get());
+}
+
+void QtnPropertyView::ItemModel::setPropertySet(QtnPropertySet *propertySet)
+{
+	if (propertySet == m_propertySet)
+		return;
+
+	m_propertySetConnections.disconnect();
+	m_propertySet = propertySet;
+
+	if (m_propertySet)
+	{
+		m_propertySetConnections.push_back(QObject::connect(m_propertySet,
+			&QtnPropertyBase::destroyed,
+			[this]() { onPropertySetDestroyed(); }));
+	}
+
+	updateItemsTree();
+}
+
+bool QtnPropertyView::ItemModel::sharedDelegates() const
+{
+	return m_sharedDelegates != nullptr;
+}
+
+void QtnPropertyView::ItemModel::setSharedDelegates(bool enabled)
+{
+	if (enabled == sharedDelegates())
+		return;
+
+	m_sharedDelegates.reset(enabled ? new SharedDelegatePool : nullptr);
+	updateItemsTree();
+}
+
+int QtnPropertyView::ItemModel::sharedDelegateCount() const
+{
+	return m_sharedDelegates ? m_sharedDelegates->count() : 0;
+}
+
+void QtnPropertyView::ItemModel::attach(QtnPropertyView *view)
+{
+	Q_ASSERT(!m_views.contains(view));
+	m_views.append(view);
+	view->invalidateVisibleItems();
+}
+
+void QtnPropertyView::ItemModel::detach(QtnPropertyView *view)
+{
+	m_views.removeOne(view);
+}
+
+void QtnPropertyView::ItemModel::lockStructure(
+	const QtnPropertyBase *property)
+{
+	m_lockedProperties.append(property);
+}
+
+void QtnPropertyView::ItemModel::unlockStructure(
+	const QtnPropertyBase *property)
+{
+	bool removed = m_lockedProperties.removeOne(property);
+	Q_ASSERT(removed);
+	Q_UNUSED(removed);
+
+	if (m_lockedProperties.isEmpty())
+		validateItemsTree();
+}
+
+void QtnPropertyView::ItemModel::updateItemsTree()
+{
+	m_treeOutdated = false;
+
+	// visible items and sub-items of views point to the items
+	for (auto view : m_views)
+		view->invalidateVisibleItems();
+
+	m_itemIndex.clear(m_itemsTree.get());
+	m_itemsTree.reset(createItemsTree(m_propertySet));
+	m_retiredItems.clear();
+	pruneBranchStates();
+}
+
+void QtnPropertyView::ItemModel::validateItemsTree()
+{
+	if (!m_treeOutdated || m_notifying > 0 || isStructureLocked())
+		return;
+
+	for (auto view : m_views)
+	{
+		if (view->m_stopInvalidate > 0)
+			return;
+	}
+
+	updateItemsTree();
+}
+
+QtnPropertyView::Item *QtnPropertyView::ItemModel::createItemsTree(
+	QtnPropertyBase *rootProperty, Item *parent)
+{
+	if (!rootProperty)
+		return nullptr;
+
+	auto item = new Item;
+	item->property = rootProperty;
+	item->parent = parent;
+	m_itemIndex.insert(item);
+	auto &connections = item->connections;
+
+	connections.push_back(
+		QObject::connect(rootProperty, &QtnPropertyBase::propertyDidChange,
+			[item, this](QtnPropertyChangeReason reason) {
+				onPropertyDidChange(reason, item);
+			}));
+
+	setupItemDelegate(item);
+
+	return item;
+}
+
+void QtnPropertyView::ItemModel::setupItemDelegate(Item *item, bool share)
+{
+	// active sub-items may belong to the item or its children
+	for (auto view : m_views)
+	{
+		if (!view->m_activeSubItems.isEmpty() || view->m_grabMouseSubItem)
+			view->deactivateSubItems();
+	}
+
 	auto property = item->property;
-	auto delegate = m_delegateFactory.createDelegate(*property);
-	Q_ASSERT(delegate); // should always return non-null
+	QtnPropertyDelegate *delegate = nullptr;
+	std::shared_ptr<QtnPropertyDelegate> sharedDelegate;
+	if (share && m_sharedDelegates)
+	{
+		sharedDelegate =
+			m_sharedDelegates->delegate(m_delegateFactory, *property);
+	}
+
+	item->sharedDelegate = (sharedDelegate != nullptr);
+	if (item->sharedDelegate)
+	{
+		item->delegate = std::move(sharedDelegate);
+	} else
+	{
+		delegate = m_delegateFactory.createDelegate(*property);
+		Q_ASSERT(delegate); // should always return non-null
+		item->delegate.reset(delegate);
+	}
 
-	item->delegate.reset(delegate);
 	item->children.clear();
 	item->wasCollapsed = item->property->isCollapsed();
+	item->lazyChildren = false;
+
+	// shared delegate is configured already and has no sub-properties
+	if (!delegate)
+		return;
 
 	// apply attributes
 	auto delegateInfo = property->delegateInfo();
@@ -1342,37 +2213,313 @@ void QtnPropertyView::setupItemDelegate(Item *item)
 		delegate->applyAttributes(*delegateInfo);
 	}
 
+	item->lazyChildren = delegate->hasLazySubProperties();
+	if (!item->lazyChildren || !isCollapsedInAllViews(item->property))
+		createItemChildren(item);
+}
+
+void QtnPropertyView::ItemModel::createItemChildren(Item *item)
+{
+	auto delegate = item->delegate.get();
+
 	// process delegate subproperties
 	for (int i = 0, n = delegate->subPropertyCount(); i < n; ++i)
 	{
 		auto child = delegate->subProperty(i);
 		Q_ASSERT(child);
 
-		auto childItem = createItemsTree(child);
-		childItem->parent = item;
-		item->children.emplace_back(childItem);
+		item->children.emplace_back(createItemsTree(child, item));
 	}
 }
 
-QtnPropertyView::VisibleItem::VisibleItem()
-	: item(nullptr)
-	, level(0)
-	, hasChildren(false)
-	, subItemsValid(false)
+void QtnPropertyView::ItemModel::updateLazyItemChildren(Item *item)
 {
+	Q_ASSERT(item->lazyChildren);
+	Q_ASSERT(!item->sharedDelegate);
+
+	bool collapsed = isCollapsedInAllViews(item->property);
+	if (collapsed == item->children.empty())
+		return;
+
+	// visible items and sub-items may point to the children
+	for (auto view : m_views)
+		invalidateViewItems(view);
+
+	if (collapsed)
+	{
+		for (auto view : m_views)
+		{
+			for (auto &child : item->children)
+			{
+				if (child->property == view->m_activeProperty)
+				{
+					view->setActivePropertyInternal(item->property);
+					break;
+				}
+			}
+		}
+
+		item->children.clear();
+		item->delegate->releaseSubProperties();
+	} else
+	{
+		createItemChildren(item);
+	}
 }
 
-void QtnPropertyView::onPropertySetDestroyed()
+void QtnPropertyView::ItemModel::setBranchCollapsed(
+	QtnPropertyView *view, QtnPropertyBase *property, bool collapsed)
 {
+	// the only view keeps its state in the property
+	if (m_views.size() <= 1)
+	{
+		view->m_branchStates.remove(property);
+		property->setCollapsed(collapsed);
+		return;
+	}
+
+	if (view->isBranchCollapsed(property) == collapsed)
+		return;
+
+	// other views keep their state of the branch
+	for (auto otherView : m_views)
+	{
+		if (!otherView->m_branchStates.contains(property))
+		{
+			otherView->m_branchStates.insert(
+				property, property->isCollapsed());
+		}
+	}
+
+	view->m_branchStates.insert(property, collapsed);
+	invalidateViewItems(view);
+	if (!view->m_restoringBranchState)
+		emit view->branchExpandedStateChanged(property, collapsed);
+
+	// property is expanded while any view expands it,
+	// so lazy sub-properties are created by expanding in any view
+	bool allCollapsed = isCollapsedInAllViews(property);
+	if (property->isCollapsed() != allCollapsed)
+	{
+		property->setCollapsed(allCollapsed);
+		return;
+	}
+
+	auto item = m_itemIndex.find(property);
+	if (item && item->lazyChildren)
+	{
+		if (isStructureLocked())
+			m_treeOutdated = true;
+		else
+			updateLazyItemChildren(item);
+	}
+}
+
+bool QtnPropertyView::ItemModel::isCollapsedInAllViews(
+	const QtnPropertyBase *property) const
+{
+	if (m_views.isEmpty())
+		return property->isCollapsed();
+
+	for (auto view : m_views)
+	{
+		if (!view->isBranchCollapsed(property))
+			return false;
+	}
+
+	return true;
+}
+
+void QtnPropertyView::ItemModel::onPropertyDidChange(
+	QtnPropertyChangeReason reason, Item *item)
+{
+	if (!reason)
+		return;
+
+	if ((reason & QtnPropertyChangeReasonName) && item)
+		m_itemIndex.rename(item);
+
+	if (reason & QtnPropertyChangeReasonChildren)
+		m_treeOutdated = true;
+
+	// items of removed properties are dropped at once,
+	// since properties may be deleted before the rebuild
+	if ((reason & QtnPropertyChangeReasonChildPropertyRemove) && item)
+		dropRemovedChildren(item);
+
+	auto viewReason = reason;
+	if (isStructureLocked())
+	{
+		const QtnPropertyChangeReason structureReason =
+			QtnPropertyChangeReasonChildPropertyAdd |
+			QtnPropertyChangeReasonUpdateDelegate;
+
+		// collapsing of lazy branch releases sub-properties
+		if ((reason & structureReason) ||
+			((reason & QtnPropertyChangeReasonState) && item &&
+				item->lazyChildren))
+		{
+			m_treeOutdated = true;
+		}
+
+		viewReason &= ~structureReason;
+	}
+
+	if (viewReason & QtnPropertyChangeReasonUpdateDelegate)
+	{
+		setupItemDelegate(item);
+	} else if ((viewReason & QtnPropertyChangeReasonState) && item &&
+		item->lazyChildren && !isStructureLocked())
+	{
+		updateLazyItemChildren(item);
+	}
+
+	bool branchToggled = false;
+	if ((reason & QtnPropertyChangeReasonState) && item)
+	{
+		bool collapsedNow = item->property->isCollapsed();
+		if (item->isBranch() && collapsedNow != item->wasCollapsed)
+		{
+			item->wasCollapsed = collapsedNow;
+			branchToggled = true;
+		}
+	}
+
+	// the tree is not rebuilt until every view is notified
+	m_notifying++;
+	auto views = m_views;
+	for (auto view : views)
+	{
+		// signal handlers may destroy views
+		if (m_views.contains(view))
+			view->onPropertyDidChange(reason, viewReason, item, branchToggled);
+	}
+	m_notifying--;
+
+	validateItemsTree();
+}
+
+void QtnPropertyView::ItemModel::dropRemovedChildren(Item *item)
+{
+	auto propertySet = item->property->asPropertySet();
+	if (!propertySet)
+		return;
+
+	QSet<const QtnPropertyBase *> properties;
+	for (auto childProperty : propertySet->childProperties())
+		properties.insert(childProperty);
+
+	auto &children = item->children;
+	auto it = std::stable_partition(children.begin(), children.end(),
+		[&properties](const std::unique_ptr<Item> &child) {
+			return properties.contains(child->property);
+		});
+	if (it == children.end())
+		return;
+
+	// visible items and sub-items of views point to the items
+	for (auto view : m_views)
+		invalidateViewItems(view);
+
+	for (auto removed = it; removed != children.end(); ++removed)
+	{
+		auto child = removed->get();
+		// removed properties may be deleted and their addresses reused
+		forgetBranchStates(child);
+		if (!containsLockedProperty(child))
+			continue;
+
+		// delegate of locked property is still used by its editor
+		disconnectTree(child);
+		m_itemIndex.removeTree(child);
+		child->parent = nullptr;
+		m_retiredItems.push_back(std::move(*removed));
+	}
+
+	children.erase(it, children.end());
+}
+
+void QtnPropertyView::ItemModel::disconnectTree(Item *item)
+{
+	item->connections.disconnect();
+	for (auto &child : item->children)
+		disconnectTree(child.get());
+}
+
+void QtnPropertyView::ItemModel::invalidateViewItems(QtnPropertyView *view)
+{
+	// view handling an event of a sub-item is invalidated by endUpdate,
+	// since the sub-item is still in use
+	if (view->m_stopInvalidate > 0)
+	{
+		view->deactivateSubItems();
+		view->m_lastChangeReason |= QtnPropertyChangeReasonState;
+	} else
+	{
+		view->invalidateVisibleItems();
+	}
+}
+
+void QtnPropertyView::ItemModel::forgetBranchStates(const Item *item)
+{
+	for (auto view : m_views)
+		view->m_branchStates.remove(item->property);
+
+	for (auto &child : item->children)
+		forgetBranchStates(child.get());
+}
+
+void QtnPropertyView::ItemModel::pruneBranchStates()
+{
+	for (auto view : m_views)
+	{
+		auto &states = view->m_branchStates;
+		for (auto it = states.begin(); it != states.end();)
+		{
+			if (m_itemIndex.find(it.key()))
+				++it;
+			else
+				it = states.erase(it);
+		}
+	}
+}
+
+bool QtnPropertyView::ItemModel::containsLockedProperty(const Item *item) const
+{
+	if (m_lockedProperties.contains(item->property))
+		return true;
+
+	for (auto &child : item->children)
+	{
+		if (containsLockedProperty(child.get()))
+			return true;
+	}
+
+	return false;
+}
+
+void QtnPropertyView::ItemModel::onPropertySetDestroyed()
+{
+	m_propertySetConnections.clear();
 	m_propertySet = nullptr;
 	updateItemsTree();
 }
 
+QtnPropertyView::VisibleItem::VisibleItem()
+	: item(nullptr)
+	, level(0)
+	, hasChildren(false)
+	, subItemsValid(false)
+{
+}
+
 void QtnPropertyView::updateWithReason(QtnPropertyChangeReason reason)
 {
 	if (reason & QtnPropertyChangeReasonChildren)
 	{
-		updateItemsTree();
+		// tree is rebuilt when no view sharing it is updating
+		m_model->validateItemsTree();
+		invalidateVisibleItems();
 	} else if (reason &
 		(QtnPropertyChangeReasonState | QtnPropertyChangeReasonUpdateDelegate))
 	{
@@ -1417,11 +2564,11 @@ QByteArray QtnPropertyView::saveBranchState() const
 			return;
 		const QString name = item->property->name();
 		const QString path = prefix.isEmpty() ? name : (prefix + QLatin1Char('.') + name);
-		if (!item->children.empty())
+		if (item->isBranch())
 		{
 			QJsonObject rec;
 			rec.insert(QStringLiteral("path"), path);
-			rec.insert(QStringLiteral("collapsed"), item->property->isCollapsed());
+			rec.insert(QStringLiteral("collapsed"), isBranchCollapsed(item->property));
 			outArray.append(rec);
 		}
 		for (const auto &child : item->children)
@@ -1434,14 +2581,14 @@ QByteArray QtnPropertyView::saveBranchState() const
 	root.insert(QStringLiteral("version"), 1);
 	// compute structure signature
 	QStringList allPaths;
-	collectAllPaths(m_itemsTree.get(), allPaths, QString());
+	collectAllPaths(m_model->root(), allPaths, QString());
 	allPaths.sort(Qt::CaseSensitive);
 	QByteArray joined = allPaths.join(QLatin1Char('\n')).toUtf8();
 	QByteArray hash = QCryptographicHash::hash(joined, QCryptographicHash::Sha1).toHex();
 	root.insert(QStringLiteral("structureHash"), QString::fromLatin1(hash));
 
 	QJsonArray branches;
-	collectBranchStates(m_itemsTree.get(), branches, QString());
+	collectBranchStates(m_model->root(), branches, QString());
 	root.insert(QStringLiteral("branches"), branches);
 
 	QJsonDocument doc(root);
@@ -1474,7 +2621,7 @@ bool QtnPropertyView::restoreBranchState(const QByteArray &data)
 			collectAllPaths(child.get(), paths, path);
 		}
 	};
-	collectAllPaths(m_itemsTree.get(), allPathsNow, QString());
+	collectAllPaths(m_model->root(), allPathsNow, QString());
 	allPathsNow.sort(Qt::CaseSensitive);
 	QByteArray joinedNow = allPathsNow.join(QLatin1Char('\n')).toUtf8();
 	QByteArray hashNow = QCryptographicHash::hash(joinedNow, QCryptographicHash::Sha1).toHex();
@@ -1500,39 +2647,52 @@ bool QtnPropertyView::restoreBranchState(const QByteArray &data)
 			buildMap(child.get(), path);
 		}
 	};
-	buildMap(m_itemsTree.get(), QString());
+	buildMap(m_model->root(), QString());
 
 	m_restoringBranchState = true;
 	{
+		// children go first, since collapsing a lazy branch releases them
 		const QJsonArray branches = branchesVal.toArray();
-		for (const QJsonValue &v : branches)
+		for (int i = branches.size() - 1; i >= 0; i--)
 		{
-			const QJsonObject rec = v.toObject();
+			const QJsonObject rec = branches.at(i).toObject();
 			const QString path = rec.value(QStringLiteral("path")).toString();
 			const bool collapsed = rec.value(QStringLiteral("collapsed")).toBool(false);
 			Item *item = pathToItem.value(path, nullptr);
 			if (!item)
 				continue;
-			if (item->children.empty())
+			if (!item->isBranch())
 				continue; // only branches
-			if (collapsed)
-				item->property->addState(QtnPropertyStateCollapsed);
-			else
-				item->property->removeState(QtnPropertyStateCollapsed);
-			item->wasCollapsed = collapsed;
+			setBranchCollapsed(item->property, collapsed);
+			item->wasCollapsed = item->property->isCollapsed();
 		}
 	}
 	m_restoringBranchState = false;
 	return true;
 }
 
+bool QtnPropertyView::isBranchCollapsed(const QtnPropertyBase *property) const
+{
+	auto it = m_branchStates.constFind(property);
+	if (it != m_branchStates.constEnd())
+		return it.value();
+
+	return property->isCollapsed();
+}
+
+void QtnPropertyView::setBranchCollapsed(
+	QtnPropertyBase *property, bool collapsed)
+{
+	m_model->setBranchCollapsed(this, property, collapsed);
+}
+
 void QtnPropertyView::setBranchCollapsedRecursively(
     QtnPropertyBase *property, bool collapsed)
 {
     if (!property)
         return;
 
-    Item *start = findItem(m_itemsTree.get(), property);
+    Item *start = findItem(property);
     if (!start)
         return;
 
@@ -1541,8 +2701,8 @@ void QtnPropertyView::setBranchCollapsedRecursively(
     apply = [&](Item *item) {
         if (!item)
             return;
-        if (!item->children.empty())
-            item->property->setCollapsed(collapsed);
+        if (item->isBranch())
+            setBranchCollapsed(item->property, collapsed);
         for (auto &ch : item->children)
             apply(ch.get());
     };
@@ -1552,7 +2712,7 @@ void QtnPropertyView::setBranchCollapsedRecursively(
 
 void QtnPropertyView::setAllBranchesCollapsed(bool collapsed)
 {
-    if (!m_itemsTree)
+    if (!m_model->root())
         return;
 
     m_restoringBranchState = true;
@@ -1560,11 +2720,11 @@ void QtnPropertyView::setAllBranchesCollapsed(bool collapsed)
     apply = [&](Item *item) {
         if (!item)
             return;
-        if (!item->children.empty())
-            item->property->setCollapsed(collapsed);
+        if (item->isBranch())
+            setBranchCollapsed(item->property, collapsed);
         for (auto &ch : item->children)
             apply(ch.get());
     };
-    apply(m_itemsTree.get());
+    apply(m_model->root());
     m_restoringBranchState = false;
 }
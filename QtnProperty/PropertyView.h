@@ -20,9 +20,13 @@ limitations under the License.
 
 #include "FunctionalHelpers.h"
 #include "Delegates/PropertyDelegateFactory.h"
+#include "Delegates/PropertyTextCache.h"
 #include "Utils/AccessibilityProxy.h"
+#include "Auxiliary/PropertyMemoryUsage.h"
+#include "Utils/QtnRowLayout.h"
 
 #include <QAbstractScrollArea>
+#include <QHash>
 
 #include <memory>
 
@@ -51,12 +55,25 @@ public:
 		QWidget *parent = nullptr, QtnPropertySet *propertySet = nullptr);
 	virtual ~QtnPropertyView() override;
 
-	inline QtnPropertyDelegateFactory *delegateFactory();
+	QtnPropertyDelegateFactory *delegateFactory();
 
-	inline const QtnPropertySet *propertySet() const;
-	inline QtnPropertySet *propertySet();
+	const QtnPropertySet *propertySet() const;
+	QtnPropertySet *propertySet();
+	// changes property set of all views sharing items with this one
 	void setPropertySet(QtnPropertySet *newPropertySet);
 
+	// Views sharing items render one reference-counted item tree
+	// with its delegates and property connections. Each view keeps
+	// its own scroll position, active property and visible rows.
+	// Property set, delegate factory and shared delegates setting
+	// are shared. Each view keeps its own expanded branches,
+	// see isBranchCollapsed.
+	void shareItemsWith(QtnPropertyView *view);
+	// gives this view an item tree of its own for the same property set,
+	// delegate factory is reset to the default one
+	void unshareItems();
+	bool sharesItemsWith(const QtnPropertyView *view) const;
+
 	QtnPropertyBase *getPropertyParent(const QtnPropertyBase *property) const;
 	inline QtnPropertyBase *activeProperty();
 	inline const QtnPropertyBase *activeProperty() const;
@@ -68,6 +85,7 @@ public:
 
 	bool ensureVisible(const QtnPropertyBase *property);
 
+	// default row height, delegates may change it with rowHeight
 	inline int itemHeight() const;
 
 	inline quint32 itemHeightSpacing() const;
@@ -78,10 +96,44 @@ public:
 	void addPropertyViewStyle(QtnPropertyViewStyle style);
 	void removePropertyViewStyle(QtnPropertyViewStyle style);
 
+	// items, delegates, sub-items and connections of this view,
+	// properties are reported by QtnPropertySet::memoryUsage.
+	// Shared items are reported by every view sharing them.
+	QtnMemoryUsage memoryUsage() const;
+
+	// When enabled, properties of the same type and delegate attributes
+	// share one delegate if it is shareable (see
+	// QtnPropertyDelegate::isShareable). A row gets its own delegate
+	// when it starts editing. Disabled by default.
+	bool sharedDelegates() const;
+	void setSharedDelegates(bool enabled);
+
+	// Property changes between beginUpdate and endUpdate
+	// are applied to the view once, by endUpdate
+	void beginUpdate();
+	void endUpdate();
+
+	// While structure is locked, item tree and delegates are not rebuilt,
+	// so sub-properties edited outside of the view stay alive.
+	// Removed child properties are dropped from the view at once,
+	// but items of the locked property and its ancestors are kept
+	// until the rebuild. Deferred rebuild is done by the last
+	// unlockStructure. Structure is locked for all views sharing items.
+	void lockStructure(const QtnPropertyBase *property = nullptr);
+	void unlockStructure(const QtnPropertyBase *property = nullptr);
+	bool isStructureLocked() const;
+
 	// Save/restore expanded/collapsed branches state
 	QByteArray saveBranchState() const;
 	bool restoreBranchState(const QByteArray &data);
 
+	// Branch is collapsed as its property state tells, until it is
+	// toggled by setBranchCollapsed of a view sharing items with others.
+	// Then each view sharing the items keeps its own state of the branch,
+	// and the property is collapsed only while all of them collapse it.
+	bool isBranchCollapsed(const QtnPropertyBase *property) const;
+	void setBranchCollapsed(QtnPropertyBase *property, bool collapsed);
+
 	// Expand/collapse helpers
 	void setBranchCollapsedRecursively(QtnPropertyBase *property, bool collapsed);
 	void setAllBranchesCollapsed(bool collapsed);
@@ -89,6 +141,11 @@ public:
 	QtnPropertyBase *getPropertyAt(
 		const QPoint &position, QRect *out_rect = nullptr);
 
+	// Looks up a property set child by name or dot separated path
+	// like QtnPropertySet::findChildProperties does.
+	// Returns nullptr if the path is not found or ambiguous.
+	QtnPropertyBase *findProperty(const QString &nameOrPath) const;
+
 	void connectPropertyToEdit(
 		QtnPropertyBase *property, QtnConnections &outConnections);
 	int valueLeftMargin() const;
@@ -182,10 +239,12 @@ protected:
 private:
 	struct Item;
 	struct VisibleItem;
+	class SharedDelegatePool;
+	class ItemIndex;
+	class ItemModel;
 
 private:
-	void updateItemsTree();
-	Item *createItemsTree(QtnPropertyBase *rootProperty);
+	void setItemModel(const std::shared_ptr<ItemModel> &model);
 
 	void setActivePropertyInternal(QtnPropertyBase *property);
 
@@ -196,12 +255,16 @@ private:
 
 	void drawItem(QStylePainter &painter, const QRect &rect,
 		const VisibleItem &vItem) const;
+	QtnDrawContext itemDrawContext(QStylePainter *painter, const QRect &rect,
+		const VisibleItem &vItem) const;
 
 	void changeActivePropertyByIndex(int index);
 	QtnPropertyBase *visiblePropertyAtPoint(const QPoint &pos) const;
 	int visibleItemIndexByPoint(const QPoint &pos) const;
 
 	bool handleMouseEvent(int index, QEvent *e, QPoint mousePos);
+	void validateSubItems(int index);
+	QRect hoverCellRect(int index, const QPoint &pos) const;
 	bool handleEvent(
 		QtnEventContext &context, VisibleItem &vItem, QPoint mousePos);
 	bool grabMouseForSubItem(QtnSubItem *subItem, QPoint mousePos);
@@ -220,28 +283,36 @@ private:
 	void connectActiveProperty();
 	void disconnectActiveProperty();
 
-	void onPropertyDidChange(QtnPropertyChangeReason reason, Item *item);
-	void onPropertySetDestroyed();
+	void onPropertyDidChange(QtnPropertyChangeReason reason,
+		QtnPropertyChangeReason viewReason, Item *item, bool branchToggled);
 	void updateWithReason(QtnPropertyChangeReason reason);
 
-	Item *findItem(Item *currentItem, const QtnPropertyBase *property) const;
-	void setupItemDelegate(Item *item);
+	Item *findItem(const QtnPropertyBase *property) const;
+	QtnPropertyDelegate *itemDelegate(const Item *item) const;
+	int itemRowHeight(const Item *item) const;
+	void updateItemRowHeight(Item *item);
+	void unshareItemDelegate(int index);
 
 private:
-	QtnPropertySet *m_propertySet;
 	QtnPropertyBase *m_activeProperty;
 	QtnPropertyBase *m_hoveredProperty = nullptr;
 	QString m_lastStatusTip;
 
-	QtnPropertyDelegateFactory m_delegateFactory;
-
-	std::unique_ptr<Item> m_itemsTree;
+	QtnPropertyTextCache m_textCache;
+	std::shared_ptr<ItemModel> m_model;
 
 	mutable QList<VisibleItem> m_visibleItems;
+	// indexes in m_visibleItems, items may be shared with other views
+	mutable QHash<const Item *, int> m_visibleIndexes;
 	mutable bool m_visibleItemsValid;
+	// tops and heights of visible items
+	mutable QtnRowLayout m_rowLayout;
 
 	QList<QtnSubItem *> m_activeSubItems;
+	Item *m_activeSubItemsItem = nullptr;
 	QtnSubItem *m_grabMouseSubItem;
+	// mouse moves inside do not change sub-items under cursor
+	QRect m_hoverRect;
 
 	QtnPropertyViewStyle m_style;
 	int m_itemHeight;
@@ -257,6 +328,10 @@ private:
 	std::unique_ptr<QRubberBand> m_rubberBand;
 	QtnPropertyChangeReason m_lastChangeReason;
 	unsigned m_stopInvalidate;
+	// collapsed state of branches toggled while items are shared
+	QHash<const QtnPropertyBase *, bool> m_branchStates;
+	// properties locked in item model by this view
+	QVector<const QtnPropertyBase *> m_structureLocks;
 	bool m_mouseAtSplitter;
 	bool m_mouseCaptured;
 	bool m_pendingRowToggle = false;
@@ -272,21 +347,6 @@ private:
 	friend struct QtnEventContext;
 };
 
-QtnPropertyDelegateFactory *QtnPropertyView::delegateFactory()
-{
-	return &m_delegateFactory;
-}
-
-const QtnPropertySet *QtnPropertyView::propertySet() const
-{
-	return m_propertySet;
-}
-
-QtnPropertySet *QtnPropertyView::propertySet()
-{
-	return m_propertySet;
-}
-
 QtnPropertyBase *QtnPropertyView::activeProperty()
 {
 	return m_activeProperty;
@@ -403,7 +403,7 @@ void QtnPropertyWidgetEx::dropEvent(QDropEvent *event)
 				applyPosition = QtnApplyPosition::After;
 			} else
 			{
-				int partHeight = view->itemHeight() / 3;
+				int partHeight = rect.height() / 3;
 
 				if (QRect(rect.left(), rect.top(), rect.width(), partHeight)
 						.contains(pos))
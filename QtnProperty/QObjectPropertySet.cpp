@@ -102,6 +102,8 @@ QtnProperty *qtnCreateQObjectProperty(QObject *object,
 			QCoreApplication::translate(className, metaProperty.name()));
 	}
 
+	property->internMetadata();
+
 	auto stateProvider = dynamic_cast<IQtnPropertyStateProvider *>(object);
 
 	if (nullptr != stateProvider)
@@ -196,6 +198,7 @@ QtnPropertySet *qtnCreateQObjectPropertySet(QObject *object, bool backwards)
 				{
 					propertySetByClass = new QtnPropertySet;
 					propertySetByClass->setName(className);
+					propertySetByClass->internMetadata();
 					propertySetsByClass[className] = propertySetByClass;
 
 					classNames.push_back(className);
@@ -28,6 +28,7 @@ SOURCES +=\
     $$PWD/Utils/InplaceEditing.cpp \
     $$PWD/Delegates/PropertyDelegate.cpp \
     $$PWD/Delegates/PropertyDelegateAux.cpp \
+    $$PWD/Delegates/PropertyTextCache.cpp \
     $$PWD/Delegates/PropertyDelegateFactory.cpp \
     $$PWD/Delegates/Core/PropertyDelegateBool.cpp \
     $$PWD/Delegates/Core/PropertyDelegateInt.cpp \
@@ -51,6 +52,7 @@ SOURCES +=\
     $$PWD/Delegates/GUI/PropertyDelegateButton.cpp \
     $$PWD/Delegates/Utils/PropertyEditorHandler.cpp \
     $$PWD/Delegates/Utils/PropertyEditorAux.cpp \
+    $$PWD/Delegates/Utils/PropertyDialogSession.cpp \
     $$PWD/Delegates/Utils/PropertyDelegateMisc.cpp \
     $$PWD/Delegates/Utils/PropertyDelegatePropertySet.cpp \
     $$PWD/Delegates/Utils/PropertyDelegateSliderBox.cpp \
@@ -77,7 +79,17 @@ SOURCES +=\
     $$PWD/PropertyConnector.cpp \
     $$PWD/Utils/QtnConnections.cpp \
     $$PWD/Utils/QtnInt64SpinBox.cpp \
+    $$PWD/Utils/QtnUpdateCoalescer.cpp \
+    $$PWD/Utils/QtnAnimationClock.cpp \
+    $$PWD/Utils/QtnSwatchCache.cpp \
+    $$PWD/Utils/QtnRowLayout.cpp \
     $$PWD/Auxiliary/PropertyDelegateInfo.cpp \
+    $$PWD/Auxiliary/PropertyCbor.cpp \
+    $$PWD/Auxiliary/PropertyNumber.cpp \
+    $$PWD/Auxiliary/PropertyStrParser.cpp \
+    $$PWD/Auxiliary/PropertyEnumRegistry.cpp \
+    $$PWD/Auxiliary/PropertyMetadata.cpp \
+    $$PWD/Auxiliary/PropertyMemoryUsage.cpp \
     $$PWD/PropertyQKeySequence.cpp \
     $$PWD/PropertyDelegateMetaEnum.cpp \
     $$PWD/Install.cpp \
@@ -98,6 +110,12 @@ HEADERS +=\
     $$PWD/Auxiliary/PropertyMacro.h \
     $$PWD/Auxiliary/PropertyAux.h \
     $$PWD/Auxiliary/PropertyDelegateInfo.h \
+    $$PWD/Auxiliary/PropertyCbor.h \
+    $$PWD/Auxiliary/PropertyNumber.h \
+    $$PWD/Auxiliary/PropertyStrParser.h \
+    $$PWD/Auxiliary/PropertyEnumRegistry.h \
+    $$PWD/Auxiliary/PropertyMetadata.h \
+    $$PWD/Auxiliary/PropertyMemoryUsage.h \
     $$PWD/Core/PropertyBool.h \
     $$PWD/Core/PropertyInt.h \
     $$PWD/Core/PropertyUInt.h \
@@ -119,6 +137,7 @@ HEADERS +=\
     $$PWD/Utils/InplaceEditing.h \
     $$PWD/Delegates/PropertyDelegate.h \
     $$PWD/Delegates/PropertyDelegateAux.h \
+    $$PWD/Delegates/PropertyTextCache.h \
     $$PWD/Delegates/PropertyDelegateFactory.h \
     $$PWD/Delegates/Core/PropertyDelegateBool.h \
     $$PWD/Delegates/Core/PropertyDelegateInt.h \
@@ -142,6 +161,7 @@ HEADERS +=\
     $$PWD/Delegates/GUI/PropertyDelegateButton.h \
     $$PWD/Delegates/Utils/PropertyEditorHandler.h \
     $$PWD/Delegates/Utils/PropertyEditorAux.h \
+    $$PWD/Delegates/Utils/PropertyDialogSession.h \
     $$PWD/Delegates/Utils/PropertyDelegateMisc.h \
     $$PWD/Delegates/Utils/PropertyDelegatePropertySet.h \
     $$PWD/Delegates/Utils/PropertyDelegateSliderBox.h \
@@ -170,6 +190,10 @@ HEADERS +=\
     $$PWD/PropertyConnector.h \
     $$PWD/Utils/QtnConnections.h \
     $$PWD/Utils/QtnInt64SpinBox.h \
+    $$PWD/Utils/QtnUpdateCoalescer.h \
+    $$PWD/Utils/QtnAnimationClock.h \
+    $$PWD/Utils/QtnSwatchCache.h \
+    $$PWD/Utils/QtnRowLayout.h \
     $$PWD/PropertyDelegateAttrs.h \
     $$PWD/PropertyQKeySequence.h \
     $$PWD/PropertyDelegateMetaEnum.h \
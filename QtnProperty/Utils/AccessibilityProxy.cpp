@@ -42,17 +42,7 @@ QtnPropertyBase *QtnAccessibilityProxy::activeProperty()
 
 QtnPropertyBase *QtnAccessibilityProxy::findProperty(QString nameOrPath)
 {
-	auto root = m_owner->propertySet();
-
-	if (!root)
-		return nullptr;
-
-	auto properties = root->findChildProperties(nameOrPath);
-
-	if (properties.size() != 1)
-		return nullptr;
-
-	return properties[0];
+	return m_owner->findProperty(nameOrPath);
 }
 
 QtnPropertyBase *QtnAccessibilityProxy::propertyUnderPoint(QPoint point)
@@ -75,7 +65,7 @@ void QtnAccessibilityProxy::ensureVisibleProperty(QtnPropertyBase *property)
 			propertyParent = currentProperty->getMasterProperty();
 		if (!propertyParent)
 			break;
-		propertyParent->removeState(QtnPropertyStateCollapsed);
+		m_owner->setBranchCollapsed(propertyParent, false);
 		currentProperty = propertyParent;
 	}
 
@@ -20,6 +20,8 @@ limitations under the License.
 #include <QKeyEvent>
 #include <QDebug>
 
+#include <algorithm>
+
 class QtnInplaceEditorHandler : public QObject
 {
 public:
@@ -27,10 +29,32 @@ public:
 	void OnEditorDestroyed(QObject *obj);
 };
 
+static const char qtnEditSessionName[] = "QtnInplaceEditSession";
+static const char qtnEditorPoolName[] = "QtnInplaceEditorPool";
+
+// free editors of the same class kept by pool
+static const int qtnMaxFreeEditors = 2;
+
 static unsigned g_inplaceEditorRetainCount = 0;
 static QWidget *g_inplaceEditor = 0;
 static QtnInplaceEditorHandler *g_inplaceEditorHandler = 0;
 
+static QtnInplaceEditorPool *qtnFindEditorPool(QWidget *parent)
+{
+	if (!parent)
+		return nullptr;
+
+	// pool has no meta object of its own, so it is found by name
+	return static_cast<QtnInplaceEditorPool *>(parent->findChild<QObject *>(
+		QLatin1String(qtnEditorPoolName), Qt::FindDirectChildrenOnly));
+}
+
+static void qtnCreateEditSession(QWidget *editor)
+{
+	auto session = new QObject(editor);
+	session->setObjectName(QLatin1String(qtnEditSessionName));
+}
+
 bool qtnStartInplaceEdit(QWidget *editor)
 {
 	if (!editor)
@@ -104,22 +128,150 @@ bool qtnStopInplaceEdit(bool delete_later, bool restoreParentFocus)
 	delete g_inplaceEditorHandler;
 	g_inplaceEditorHandler = nullptr;
 
+	auto editor = g_inplaceEditor;
+	g_inplaceEditor = nullptr;
+
+	auto pool = qtnFindEditorPool(editor->parentWidget());
+	if (pool && pool->release(editor, delete_later, restoreParentFocus))
+		return true;
+
 	if (restoreParentFocus)
 	{
 		QObject::connect(
-			g_inplaceEditor, &QObject::destroyed, &onInplaceWidgetDestroyed);
+			editor, &QObject::destroyed, &onInplaceWidgetDestroyed);
 	}
 
 	if (delete_later)
-		g_inplaceEditor->deleteLater();
+		editor->deleteLater();
 	else
-		delete g_inplaceEditor;
+		delete editor;
 
-	g_inplaceEditor = nullptr;
+	return true;
+}
+
+QObject *qtnInplaceEditSession(QWidget *editor)
+{
+	Q_ASSERT(editor);
+	auto session = editor->findChild<QObject *>(
+		QLatin1String(qtnEditSessionName), Qt::FindDirectChildrenOnly);
+	return session ? session : editor;
+}
+
+QtnInplaceEditorPool::QtnInplaceEditorPool(QWidget *parent)
+	: QObject(parent)
+{
+	setObjectName(QLatin1String(qtnEditorPoolName));
+}
+
+QtnInplaceEditorPool *QtnInplaceEditorPool::forWidget(QWidget *parent)
+{
+	if (!parent)
+		return nullptr;
+
+	auto pool = qtnFindEditorPool(parent);
+	if (!pool)
+		pool = new QtnInplaceEditorPool(parent);
+
+	return pool;
+}
+
+bool QtnInplaceEditorPool::release(
+	QWidget *editor, bool deleteLater, bool restoreParentFocus)
+{
+	auto it = std::find_if(m_entries.begin(), m_entries.end(),
+		[editor](const Entry &entry) -> bool {
+			return entry.busy && entry.editor == editor;
+		});
+	if (it == m_entries.end())
+		return false;
+
+	auto session = editor->findChild<QObject *>(
+		QLatin1String(qtnEditSessionName), Qt::FindDirectChildrenOnly);
+	Q_ASSERT(session);
+
+	// editor is not bound to the edit anymore,
+	// handlers of the session must not stop next edit
+	session->setObjectName(QString());
+
+	// do not let editor emit editingFinished and such on hide
+	bool blocked = editor->blockSignals(true);
+	editor->hide();
+	editor->blockSignals(blocked);
+
+	if (restoreParentFocus)
+		editor->parentWidget()->setFocus();
+
+	if (deleteLater)
+	{
+		// editor becomes free when handlers are gone
+		QPointer<QWidget> editorPtr(editor);
+		QObject::connect(session, &QObject::destroyed, this,
+			[this, editorPtr]() {
+				if (editorPtr)
+					makeFree(editorPtr);
+			});
+		session->deleteLater();
+	} else
+	{
+		delete session;
+		makeFree(editor);
+	}
 
 	return true;
 }
 
+QWidget *QtnInplaceEditorPool::take(const std::type_info &type)
+{
+	for (auto &entry : m_entries)
+	{
+		if (entry.busy || !entry.editor || *entry.type != type)
+			continue;
+
+		entry.busy = true;
+		qtnCreateEditSession(entry.editor);
+		return entry.editor;
+	}
+
+	return nullptr;
+}
+
+void QtnInplaceEditorPool::bind(QWidget *editor, const std::type_info &type)
+{
+	m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+						[](const Entry &entry) -> bool {
+							return entry.editor.isNull();
+						}),
+		m_entries.end());
+
+	m_entries.append(Entry{ &type, editor, true });
+	qtnCreateEditSession(editor);
+}
+
+void QtnInplaceEditorPool::makeFree(QWidget *editor)
+{
+	auto it = std::find_if(m_entries.begin(), m_entries.end(),
+		[editor](const Entry &entry) -> bool {
+			return entry.editor == editor;
+		});
+	if (it == m_entries.end())
+		return;
+
+	auto type = it->type;
+	int freeCount = int(std::count_if(m_entries.cbegin(), m_entries.cend(),
+		[type](const Entry &entry) -> bool {
+			return !entry.busy && entry.editor && *entry.type == *type;
+		}));
+
+	if (freeCount >= qtnMaxFreeEditors)
+	{
+		m_entries.erase(it);
+		editor->deleteLater();
+		return;
+	}
+
+	it->busy = false;
+}
+
 bool hasParent(QObject *child, QObject *parent)
 {
 	if (!child)
@@ -21,6 +21,10 @@ limitations under the License.
 #include "QtnProperty/Config.h"
 
 #include <QWidget>
+#include <QPointer>
+#include <QVector>
+
+#include <typeinfo>
 
 QTN_IMPORT_EXPORT void qtnRetainInplaceEditor();
 QTN_IMPORT_EXPORT void qtnReleaseInplaceEditor();
@@ -29,4 +33,64 @@ QTN_IMPORT_EXPORT QWidget *qtnGetInplaceEdit();
 QTN_IMPORT_EXPORT bool qtnStopInplaceEdit(
 	bool delete_later = true, bool restoreParentFocus = true);
 
+// Returns object that lives while editor is bound to current edit.
+// Editor handlers and per-edit connections should be owned by it.
+// For editors not managed by QtnInplaceEditorPool it is the editor itself.
+QTN_IMPORT_EXPORT QObject *qtnInplaceEditSession(QWidget *editor);
+
+// Keeps inplace editors of a view for reuse.
+// Editor acquired from the pool is hidden and returned to the pool
+// by qtnStopInplaceEdit instead of deletion. Edit session of the editor
+// is deleted instead, so handlers are recreated for the next edit.
+// Delegate acquiring an editor must configure all its state again.
+class QTN_IMPORT_EXPORT QtnInplaceEditorPool : public QObject
+{
+	Q_DISABLE_COPY(QtnInplaceEditorPool)
+
+public:
+	template <typename EditorClass>
+	static EditorClass *acquire(QWidget *parent);
+
+	// pool is created on demand, nullptr for nullptr parent
+	static QtnInplaceEditorPool *forWidget(QWidget *parent);
+
+	// returns false if editor is not managed by the pool
+
+	bool release(
+		QWidget *editor, bool deleteLater, bool restoreParentFocus);
+
+private:
+	explicit QtnInplaceEditorPool(QWidget *parent);
+
+	QWidget *take(const std::type_info &type);
+	void bind(QWidget *editor, const std::type_info &type);
+	void makeFree(QWidget *editor);
+
+	struct Entry
+	{
+		const std::type_info *type;
+		QPointer<QWidget> editor;
+		bool busy;
+	};
+
+	QVector<Entry> m_entries;
+};
+
+template <typename EditorClass>
+EditorClass *QtnInplaceEditorPool::acquire(QWidget *parent)
+{
+	auto pool = forWidget(parent);
+	if (!pool)
+		return new EditorClass(parent);
+
+	auto editor = static_cast<EditorClass *>(pool->take(typeid(EditorClass)));
+	if (!editor)
+	{
+		editor = new EditorClass(parent);
+		pool->bind(editor, typeid(EditorClass));
+	}
+
+	return editor;
+}
+
 #endif // INPLACE_EDITING_H
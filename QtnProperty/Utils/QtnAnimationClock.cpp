@@ -0,0 +1,124 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#include "QtnAnimationClock.h"
+#include "QtnUpdateCoalescer.h"
+
+#include <QWidget>
+
+#include <algorithm>
+
+static const char qtnAnimationClockName[] = "QtnAnimationClock";
+
+QtnAnimationClock::QtnAnimationClock(QWidget *widget)
+	: QObject(widget)
+	, m_widget(widget)
+{
+	setObjectName(QLatin1String(qtnAnimationClockName));
+	m_timer.setTimerType(Qt::PreciseTimer);
+	QObject::connect(&m_timer, &QTimer::timeout, this, [this]() { tick(); });
+}
+
+QtnAnimationClock *QtnAnimationClock::forWidget(QWidget *widget)
+{
+	if (!widget)
+		return nullptr;
+
+	// clock has no meta object of its own, so it is found by name
+	auto clock = static_cast<QtnAnimationClock *>(widget->findChild<QObject *>(
+		QLatin1String(qtnAnimationClockName), Qt::FindDirectChildrenOnly));
+	if (!clock)
+		clock = new QtnAnimationClock(widget);
+
+	return clock;
+}
+
+void QtnAnimationClock::start(const void *owner, double from, double to,
+	int duration, const QEasingCurve &easing, const Handler &handler)
+{
+	Q_ASSERT(owner);
+	Q_ASSERT(handler);
+
+	stop(owner);
+
+	if (!m_time.isValid())
+		m_time.start();
+
+	m_animations.append(Animation{ owner, from, to, qMax(1, duration), easing,
+		m_time.elapsed(), handler });
+
+	if (!m_timer.isActive())
+		m_timer.start(qMax(1, QtnUpdateCoalescer::defaultInterval()));
+}
+
+void QtnAnimationClock::stop(const void *owner)
+{
+	m_animations.erase(std::remove_if(m_animations.begin(),
+						   m_animations.end(),
+						   [owner](const Animation &animation) -> bool {
+							   return animation.owner == owner;
+						   }),
+		m_animations.end());
+
+	if (m_animations.isEmpty())
+		m_timer.stop();
+}
+
+bool QtnAnimationClock::isRunning(const void *owner) const
+{
+	return std::any_of(m_animations.cbegin(), m_animations.cend(),
+		[owner](const Animation &animation) -> bool {
+			return animation.owner == owner;
+		});
+}
+
+void QtnAnimationClock::tick()
+{
+	auto now = m_time.elapsed();
+
+	// handlers may start or stop animations
+	auto animations = m_animations;
+	for (auto &animation : animations)
+	{
+		// skip animations stopped or restarted by handlers
+		auto it = std::find_if(m_animations.begin(), m_animations.end(),
+			[&animation](const Animation &running) -> bool {
+				return running.owner == animation.owner &&
+					running.startTime == animation.startTime;
+			});
+		if (it == m_animations.end())
+			continue;
+
+		double progress =
+			qMin(1.0, double(now - animation.startTime) / animation.duration);
+
+		// finished animation is removed before its last value is applied,
+		// so owner sees it is not running anymore
+		if (progress >= 1.0)
+			m_animations.erase(it);
+
+		double value = animation.from +
+			(animation.to - animation.from) *
+				animation.easing.valueForProgress(progress);
+		auto rect = animation.handler(value);
+		if (!rect.isEmpty())
+			m_widget->update(rect);
+	}
+
+	if (m_animations.isEmpty())
+		m_timer.stop();
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QEasingCurve>
+#include <QRect>
+#include <QVector>
+
+#include <functional>
+
+// Drives all value animations of a widget with a single timer.
+// On each tick every running animation gets its current value
+// and returns the rect to repaint, so only animating rows are updated.
+// Timer interval is QtnUpdateCoalescer::defaultInterval().
+class QTN_IMPORT_EXPORT QtnAnimationClock : public QObject
+{
+	Q_DISABLE_COPY(QtnAnimationClock)
+
+public:
+	// applies animated value and returns rect to repaint
+	using Handler = std::function<QRect(double value)>;
+
+	// clock is created on demand, nullptr for nullptr widget
+	static QtnAnimationClock *forWidget(QWidget *widget);
+
+	// restarts animation of the owner if it is running
+	void start(const void *owner, double from, double to, int duration,
+		const QEasingCurve &easing, const Handler &handler);
+	void stop(const void *owner);
+	bool isRunning(const void *owner) const;
+	inline int runningCount() const;
+
+private:
+	explicit QtnAnimationClock(QWidget *widget);
+
+	void tick();
+
+	struct Animation
+	{
+		const void *owner;
+		double from;
+		double to;
+		int duration;
+		QEasingCurve easing;
+		qint64 startTime;
+		Handler handler;
+	};
+
+	QWidget *m_widget;
+	QVector<Animation> m_animations;
+	QTimer m_timer;
+	QElapsedTimer m_time;
+};
+
+int QtnAnimationClock::runningCount() const
+{
+	return m_animations.size();
+}
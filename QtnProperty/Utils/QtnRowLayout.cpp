@@ -0,0 +1,102 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#include "QtnRowLayout.h"
+
+QtnRowLayout::QtnRowLayout()
+	: m_totalHeight(0)
+	, m_highBit(0)
+{
+}
+
+void QtnRowLayout::reset(const QVector<int> &heights)
+{
+	int count = heights.size();
+	m_heights = heights;
+	m_tree.fill(0, count + 1);
+	m_totalHeight = 0;
+
+	for (int i = 1; i <= count; i++)
+	{
+		int height = heights.at(i - 1);
+		m_totalHeight += height;
+		m_tree[i] += height;
+
+		int parent = i + (i & -i);
+		if (parent <= count)
+			m_tree[parent] += m_tree[i];
+	}
+
+	m_highBit = count > 0 ? 1 : 0;
+	while (m_highBit * 2 <= count)
+		m_highBit *= 2;
+}
+
+void QtnRowLayout::clear()
+{
+	m_heights.clear();
+	m_tree.clear();
+	m_totalHeight = 0;
+	m_highBit = 0;
+}
+
+void QtnRowLayout::setHeight(int row, int height)
+{
+	Q_ASSERT(row >= 0 && row < count());
+
+	int delta = height - m_heights.at(row);
+	if (delta == 0)
+		return;
+
+	m_heights[row] = height;
+	m_totalHeight += delta;
+
+	for (int i = row + 1, n = count(); i <= n; i += i & -i)
+		m_tree[i] += delta;
+}
+
+int QtnRowLayout::top(int row) const
+{
+	Q_ASSERT(row >= 0 && row <= count());
+
+	int result = 0;
+	for (int i = row; i > 0; i -= i & -i)
+		result += m_tree.at(i);
+
+	return result;
+}
+
+int QtnRowLayout::rowAt(int y) const
+{
+	if (y < 0 || y >= m_totalHeight)
+		return -1;
+
+	// find the number of rows ending at or above y
+	int row = 0;
+	int count = this->count();
+	for (int step = m_highBit; step > 0; step >>= 1)
+	{
+		int next = row + step;
+		if (next <= count && m_tree.at(next) <= y)
+		{
+			row = next;
+			y -= m_tree.at(next);
+		}
+	}
+
+	return row;
+}
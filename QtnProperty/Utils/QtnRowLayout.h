@@ -0,0 +1,67 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+
+#include <QVector>
+
+// Vertical layout of rows with individual heights.
+// Row tops are prefix sums of heights kept in a Fenwick tree,
+// so top(), rowAt() and setHeight() are O(log N).
+class QTN_IMPORT_EXPORT QtnRowLayout
+{
+public:
+	QtnRowLayout();
+
+	// O(N)
+	void reset(const QVector<int> &heights);
+	void clear();
+
+	inline int count() const;
+	inline int totalHeight() const;
+	inline int height(int row) const;
+	void setHeight(int row, int height);
+
+	// sum of heights of rows before row, row can be count()
+	int top(int row) const;
+	// row containing y, -1 if y is outside of rows
+	int rowAt(int y) const;
+
+private:
+	QVector<int> m_heights;
+	// 1-based, m_tree[i] is sum of (i & -i) heights ending at row i - 1
+	QVector<int> m_tree;
+	int m_totalHeight;
+	int m_highBit;
+};
+
+int QtnRowLayout::count() const
+{
+	return m_heights.size();
+}
+
+int QtnRowLayout::totalHeight() const
+{
+	return m_totalHeight;
+}
+
+int QtnRowLayout::height(int row) const
+{
+	return m_heights.at(row);
+}
@@ -0,0 +1,300 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#include "QtnSwatchCache.h"
+
+#include <QCache>
+#include <QCoreApplication>
+#include <QPainter>
+#include <QPainterPath>
+#include <QPixmap>
+#include <QtMath>
+
+namespace
+{
+enum
+{
+	DefaultCapacity = 4096
+};
+
+enum SwatchKind
+{
+	SwatchColor,
+	SwatchChecker,
+	SwatchBrush,
+	SwatchPen
+};
+
+struct SwatchKey
+{
+	int kind;
+	int style;
+	QRgb color1;
+	QRgb color2;
+	int param;
+	int width;
+	int height;
+	int ratio;
+
+	inline bool operator==(const SwatchKey &other) const
+	{
+		return kind == other.kind && style == other.style &&
+			color1 == other.color1 && color2 == other.color2 &&
+			param == other.param && width == other.width &&
+			height == other.height && ratio == other.ratio;
+	}
+
+	friend inline uint qHash(const SwatchKey &key, uint seed = 0)
+	{
+		return qHash(key.color1, seed) ^ qHash(key.color2, seed << 1) ^
+			uint(key.width) ^ (uint(key.height) << 10) ^
+			(uint(key.style) << 16) ^ (uint(key.kind) << 28) ^
+			uint(key.param) ^ (uint(key.ratio) << 20);
+	}
+};
+
+using SwatchPixmaps = QCache<SwatchKey, QPixmap>;
+
+SwatchPixmaps *theSwatchPixmaps = nullptr;
+int theSwatchCapacity = DefaultCapacity;
+
+// pixmaps must not outlive the application
+void destroySwatchPixmaps()
+{
+	delete theSwatchPixmaps;
+	theSwatchPixmaps = nullptr;
+}
+
+SwatchPixmaps &swatchPixmaps()
+{
+	if (!theSwatchPixmaps)
+	{
+		theSwatchPixmaps = new SwatchPixmaps(theSwatchCapacity);
+		qAddPostRoutine(destroySwatchPixmaps);
+	}
+
+	return *theSwatchPixmaps;
+}
+
+QRgb swatchRgba(const QColor &color)
+{
+	return color.isValid() ? color.rgba() : 0;
+}
+
+SwatchKey swatchKey(SwatchKind kind, int style, const QColor &color1,
+	const QColor &color2, int param = 0)
+{
+	SwatchKey key;
+	key.kind = kind;
+	key.style = style;
+	key.color1 = swatchRgba(color1);
+	key.color2 = swatchRgba(color2);
+	key.param = param;
+	key.width = 0;
+	key.height = 0;
+	key.ratio = 0;
+	return key;
+}
+
+int swatchPenParam(const QPen &pen)
+{
+	return qRound(pen.widthF() * 100) | (int(pen.capStyle()) << 20);
+}
+
+// render paints into rect at origin in logical pixels
+template <typename RENDER>
+void drawSwatch(
+	QPainter &painter, const QRect &rect, SwatchKey key, const RENDER &render)
+{
+	if (rect.isEmpty())
+		return;
+
+	auto device = painter.device();
+	qreal ratio = device ? device->devicePixelRatioF() : 1.0;
+	key.width = rect.width();
+	key.height = rect.height();
+	key.ratio = qRound(ratio * 100);
+
+	auto &pixmaps = swatchPixmaps();
+	QPixmap pixmap;
+	auto cached = pixmaps.object(key);
+	if (cached)
+	{
+		pixmap = *cached;
+	} else
+	{
+		pixmap = QPixmap(
+			qCeil(rect.width() * ratio), qCeil(rect.height() * ratio));
+		pixmap.setDevicePixelRatio(ratio);
+		pixmap.fill(Qt::transparent);
+		{
+			QPainter pixmapPainter(&pixmap);
+			render(pixmapPainter, QRect(QPoint(), rect.size()));
+		}
+
+		// cost in kilobytes, too big pixmaps are not cached by QCache
+		int cost = qMax(1, pixmap.width() * pixmap.height() * 4 / 1024);
+		pixmaps.insert(key, new QPixmap(pixmap), cost);
+	}
+
+	painter.drawPixmap(rect.topLeft(), pixmap);
+}
+
+void renderChecker(QPainter &painter, const QRect &rect, const QColor &color1,
+	const QColor &color2, int cellSize)
+{
+	painter.fillRect(rect, color1);
+
+	int row = 0;
+	for (int y = rect.top(); y <= rect.bottom(); y += cellSize, row++)
+	{
+		for (int x = rect.left() + ((row & 1) ? 0 : cellSize);
+			 x <= rect.right(); x += 2 * cellSize)
+		{
+			painter.fillRect(
+				QRect(x, y, cellSize, cellSize).intersected(rect), color2);
+		}
+	}
+}
+
+void renderTranslucentBackground(QPainter &painter, const QRect &rect,
+	const QColor &color)
+{
+	if (color.alpha() < 255)
+		renderChecker(painter, rect, Qt::white, QColor(204, 204, 204), 4);
+}
+} // namespace
+
+void QtnSwatchCache::drawColor(QPainter &painter, const QRect &rect,
+	const QColor &color, QtnSwatchShape shape, const QColor &borderColor)
+{
+	auto key = swatchKey(SwatchColor, shape, color,
+		shape == QtnSwatchShapeRoundedRect ? QColor() : borderColor);
+
+	drawSwatch(painter, rect, key,
+		[&color, shape, &borderColor](QPainter &p, const QRect &r) {
+			switch (shape)
+			{
+				case QtnSwatchShapeSquare:
+				{
+					p.fillRect(r, borderColor);
+					auto colorRect = r.adjusted(1, 1, -1, -1);
+					renderTranslucentBackground(p, colorRect, color);
+					p.fillRect(colorRect, color);
+					break;
+				}
+
+				case QtnSwatchShapeCircle:
+				{
+					p.setRenderHint(QPainter::Antialiasing);
+					QPainterPath path;
+					path.addEllipse(QRectF(r).adjusted(0.5, 0.5, -0.5, -0.5));
+					if (color.alpha() < 255)
+					{
+						p.setClipPath(path);
+						renderTranslucentBackground(p, r, color);
+						p.setClipping(false);
+					}
+
+					if (borderColor.isValid())
+						p.setPen(borderColor);
+					else
+						p.setPen(Qt::NoPen);
+					p.setBrush(color);
+					p.drawPath(path);
+					break;
+				}
+
+				case QtnSwatchShapeRoundedRect:
+				{
+					p.setRenderHint(QPainter::Antialiasing);
+					QPainterPath path;
+					path.addRoundedRect(QRectF(r.adjusted(1, 1, -1, -1)), 2, 2);
+					p.setClipPath(path);
+					renderTranslucentBackground(p, r, color);
+					p.fillRect(r, color);
+					break;
+				}
+			}
+		});
+}
+
+void QtnSwatchCache::drawChecker(QPainter &painter, const QRect &rect,
+	const QColor &color1, const QColor &color2, int cellSize)
+{
+	cellSize = qMax(1, cellSize);
+	auto key = swatchKey(SwatchChecker, 0, color1, color2, cellSize);
+
+	drawSwatch(painter, rect, key,
+		[&color1, &color2, cellSize](QPainter &p, const QRect &r) {
+			renderChecker(p, r, color1, color2, cellSize);
+		});
+}
+
+void QtnSwatchCache::drawBrushStyle(
+	QPainter &painter, const QRect &rect, Qt::BrushStyle brushStyle)
+{
+	QPen pen = painter.pen();
+	QColor brushColor = painter.brush().color();
+	auto key = swatchKey(SwatchBrush, brushStyle | (int(pen.style()) << 8),
+		pen.color(), brushColor, swatchPenParam(pen));
+
+	drawSwatch(painter, rect, key,
+		[&pen, &brushColor, brushStyle](QPainter &p, const QRect &r) {
+			p.setPen(pen);
+			p.setBrush(QBrush(brushColor, brushStyle));
+			p.drawRect(r.adjusted(0, 0, -1, -1));
+		});
+}
+
+void QtnSwatchCache::drawPenStyle(
+	QPainter &painter, const QRect &rect, Qt::PenStyle penStyle)
+{
+	QPen pen = painter.pen();
+	pen.setStyle(penStyle);
+	auto key = swatchKey(
+		SwatchPen, penStyle, pen.color(), QColor(), swatchPenParam(pen));
+
+	drawSwatch(painter, rect, key, [&pen](QPainter &p, const QRect &r) {
+		p.setPen(pen);
+		auto midY = r.center().y();
+		p.drawLine(r.left(), midY, r.right(), midY);
+	});
+}
+
+void QtnSwatchCache::clear()
+{
+	if (theSwatchPixmaps)
+		theSwatchPixmaps->clear();
+}
+
+int QtnSwatchCache::count()
+{
+	return theSwatchPixmaps ? theSwatchPixmaps->count() : 0;
+}
+
+int QtnSwatchCache::capacity()
+{
+	return theSwatchCapacity;
+}
+
+void QtnSwatchCache::setCapacity(int kilobytes)
+{
+	theSwatchCapacity = qMax(0, kilobytes);
+	if (theSwatchPixmaps)
+		theSwatchPixmaps->setMaxCost(theSwatchCapacity);
+}
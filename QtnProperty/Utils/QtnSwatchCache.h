@@ -0,0 +1,63 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+
+#include <QColor>
+#include <QRect>
+
+class QPainter;
+
+enum QtnSwatchShape
+{
+	QtnSwatchShapeSquare,
+	QtnSwatchShapeCircle,
+	QtnSwatchShapeRoundedRect
+};
+
+// Shared LRU cache of small pixmaps painted by color-like delegates:
+// color swatches, transparency checkerboards, brush and pen style samples.
+// Pixmaps are rendered at device pixel ratio of the painter's device,
+// so cached items stay sharp on high DPI screens.
+// Cache is used from GUI thread only and is cleared on style change.
+class QTN_IMPORT_EXPORT QtnSwatchCache
+{
+public:
+	// translucent colors are drawn over a checkerboard,
+	// borderColor is ignored for QtnSwatchShapeRoundedRect
+	static void drawColor(QPainter &painter, const QRect &rect,
+		const QColor &color, QtnSwatchShape shape,
+		const QColor &borderColor = QColor());
+	// cellSize is in logical pixels
+	static void drawChecker(QPainter &painter, const QRect &rect,
+		const QColor &color1, const QColor &color2, int cellSize = 8);
+	// outlines rect with painter's pen and fills it
+	// with painter's brush color of brushStyle
+	static void drawBrushStyle(
+		QPainter &painter, const QRect &rect, Qt::BrushStyle brushStyle);
+	// draws horizontal line through rect center with painter's pen
+	static void drawPenStyle(
+		QPainter &painter, const QRect &rect, Qt::PenStyle penStyle);
+
+	static void clear();
+	static int count();
+	// in kilobytes of pixmap data
+	static int capacity();
+	static void setCapacity(int kilobytes);
+};
@@ -0,0 +1,97 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#include "QtnUpdateCoalescer.h"
+
+#include <QAtomicInt>
+
+static QAtomicInt qtnDefaultUpdateInterval(16);
+
+QtnUpdateCoalescer::QtnUpdateCoalescer()
+	: m_interval(-1)
+{
+	m_timer.setSingleShot(true);
+	QObject::connect(
+		&m_timer, &QTimer::timeout, [this]() { applyPending(); });
+}
+
+QtnUpdateCoalescer::~QtnUpdateCoalescer() {}
+
+void QtnUpdateCoalescer::post(const Update &update)
+{
+	Q_ASSERT(update);
+
+	int msec = interval();
+	if (!m_pending &&
+		(msec <= 0 || !m_lastApplied.isValid() ||
+			m_lastApplied.elapsed() >= msec))
+	{
+		m_lastApplied.start();
+		update();
+		return;
+	}
+
+	m_pending = update;
+	if (!m_timer.isActive())
+	{
+		m_timer.start(int(qMax(qint64(0), msec - m_lastApplied.elapsed())));
+	}
+}
+
+void QtnUpdateCoalescer::flush()
+{
+	m_timer.stop();
+	applyPending();
+}
+
+void QtnUpdateCoalescer::cancel()
+{
+	m_timer.stop();
+	m_pending = nullptr;
+}
+
+int QtnUpdateCoalescer::interval() const
+{
+	return m_interval >= 0 ? m_interval : defaultInterval();
+}
+
+void QtnUpdateCoalescer::setInterval(int msec)
+{
+	m_interval = msec;
+}
+
+int QtnUpdateCoalescer::defaultInterval()
+{
+	return qtnDefaultUpdateInterval.load();
+}
+
+void QtnUpdateCoalescer::setDefaultInterval(int msec)
+{
+	qtnDefaultUpdateInterval.store(qMax(0, msec));
+}
+
+void QtnUpdateCoalescer::applyPending()
+{
+	if (!m_pending)
+		return;
+
+	// update may post again
+	Update update;
+	update.swap(m_pending);
+	m_lastApplied.start();
+	update();
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************
+Copyright (c) 2015-2021 Alexandra Cherdantseva <neluhus.vagus@gmail.com>
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "QtnProperty/Config.h"
+
+#include <QTimer>
+#include <QElapsedTimer>
+
+#include <functional>
+
+// Limits rate of frequent updates like mouse drag, wheel or key repeat.
+// An update is applied at once if previous one was applied at least
+// interval ago. Otherwise it is kept pending, replacing the previous
+// pending update, and is applied when the interval elapses.
+// Pending update is dropped on destruction, so call flush() to apply it.
+class QTN_IMPORT_EXPORT QtnUpdateCoalescer
+{
+	Q_DISABLE_COPY(QtnUpdateCoalescer)
+
+public:
+	using Update = std::function<void()>;
+
+	QtnUpdateCoalescer();
+	~QtnUpdateCoalescer();
+
+	void post(const Update &update);
+	void flush();
+	void cancel();
+	inline bool hasPending() const;
+
+	// negative interval means defaultInterval()
+	int interval() const;
+	void setInterval(int msec);
+
+	// Interval of coalescers without own interval, 16 msec by default.
+	// Set it to 1000 / QScreen::refreshRate() to follow the display.
+	static int defaultInterval();
+	static void setDefaultInterval(int msec);
+
+private:
+	void applyPending();
+
+	Update m_pending;
+	QTimer m_timer;
+	QElapsedTimer m_lastApplied;
+	int m_interval;
+};
+
+bool QtnUpdateCoalescer::hasPending() const
+{
+	return bool(m_pending);
+}
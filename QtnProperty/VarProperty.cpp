@@ -23,16 +23,64 @@ limitations under the License.
 #include "Core/PropertyUInt.h"
 #include "Core/PropertyDouble.h"
 #include "Core/PropertyQString.h"
+#include "GUI/PropertyButton.h"
+#include "PropertyDelegateAttrs.h"
+
+#include <QTimer>
+#include <QStyleOptionButton>
+
+#include <algorithm>
+#include <iterator>
 
 VarProperty::VarProperty(QObject *parent, VarProperty::Type type,
 	const QString &name, int index, const QVariant &value)
 	: QObject(parent)
 	, varParent(nullptr)
-	, value(type == Value ? value : QVariant())
 	, name(name)
+	, placeholder(nullptr)
 	, index(index)
+	, eagerBudget(0)
 	, type(type)
+	, materializing(false)
+{
+	switch (type)
+	{
+		case List:
+			this->value = value.toList();
+			break;
+
+		case Map:
+			this->value = value.toMap();
+			break;
+
+		case Value:
+			this->value = value;
+			break;
+	}
+
+	auto property = qobject_cast<QtnPropertyBase *>(parent);
+
+	if (nullptr != property)
+		property->setVarProperty(this);
+}
+
+VarProperty::~VarProperty()
 {
+	// properties and var children may outlive the tree
+	for (auto child : varChildren)
+		child->varParent = nullptr;
+
+	if (nullptr != varParent)
+	{
+		auto &siblings = varParent->varChildren;
+		siblings.erase(std::remove(siblings.begin(), siblings.end(), this),
+			siblings.end());
+	}
+
+	auto property = qobject_cast<QtnPropertyBase *>(parent());
+
+	if (nullptr != property && property->getVarProperty() == this)
+		property->setVarProperty(nullptr);
 }
 
 void VarProperty::ChangePropertyValue(const QVariant &value, QVariant *dest)
@@ -41,6 +89,9 @@ void VarProperty::ChangePropertyValue(const QVariant &value, QVariant *dest)
 	{
 		this->value = value;
 
+		if (nullptr != varParent)
+			varParent->UpdateChildValue(this);
+
 		if (nullptr != dest)
 		{
 			auto top = TopParent();
@@ -56,6 +107,8 @@ void VarProperty::RemoveFromParent()
 {
 	if (nullptr != varParent)
 	{
+		varParent->Materialize();
+
 		auto &siblings = varParent->varChildren;
 
 		auto it = std::find(siblings.begin(), siblings.end(), this);
@@ -63,6 +116,7 @@ void VarProperty::RemoveFromParent()
 		if (it != siblings.end())
 		{
 			siblings.erase(it);
+			varParent->UpdateValue();
 		}
 	}
 }
@@ -98,12 +152,18 @@ VarProperty *VarProperty::Duplicate(const QString &new_name)
 
 VarProperty *VarProperty::AddChild(VarProperty *child, int index)
 {
+	if (!materializing)
+		Materialize();
+
 	if (index < 0)
 		index = static_cast<int>(varChildren.size());
 
 	child->varParent = this;
 	varChildren.insert(varChildren.begin() + index, child);
 
+	if (!materializing)
+		UpdateValue();
+
 	return child;
 }
 
@@ -195,8 +255,14 @@ bool VarProperty::SetName(const QString &newName)
 {
 	if (index < 0 && name != newName)
 	{
+		if (nullptr != varParent)
+			varParent->Materialize();
+
 		name = newName;
 
+		if (nullptr != varParent)
+			varParent->UpdateValue();
+
 		return true;
 	}
 
@@ -235,49 +301,137 @@ VarProperty::VarChildren &VarProperty::GetChildren()
 
 int VarProperty::GetChildrenCount() const
 {
-	return int(varChildren.size());
+	if (Value == type)
+		return int(varChildren.size());
+
+	return GetSourceCount();
 }
 
-void VarProperty::SetValue(const QVariant &value)
+bool VarProperty::IsMaterialized() const
 {
-	this->value = value;
+	return int(varChildren.size()) >= GetSourceCount();
+}
+
+void VarProperty::Materialize(int count)
+{
+	int first = int(varChildren.size());
+	int total = GetSourceCount();
+	int last = (count < 0) ? total : qMin(total, first + count);
+
+	if (first >= last)
+		return;
+
+	auto set = qobject_cast<QtnPropertySet *>(parent());
+
+	QList<QtnPropertyBase *> properties;
+	properties.reserve(last - first);
+
+	auto addElement = [this, set, &properties](const QVariant &element,
+						  const QString &key, int elementIndex) {
+		if (nullptr == set)
+		{
+			AddChild(new VarProperty(nullptr, GetTypeFromValue(element), key,
+						 elementIndex, element),
+				elementIndex);
+		} else
+		{
+			properties.append(NewExtraProperty(
+				nullptr, element, key, elementIndex, this, registerProperty));
+		}
+	};
+
+	materializing = true;
 
 	switch (type)
 	{
-		case Map:
 		case List:
+		{
+			auto list = value.toList();
 
-			for (auto child : varChildren)
+			for (int i = first; i < last; i++)
+			{
+				addElement(list.at(i), QString(), i);
+			}
+
+			break;
+		}
+
+		case Map:
+		{
+			auto map = value.toMap();
+			auto it = map.cbegin();
+			std::advance(it, first);
+
+			for (int i = first; i < last; i++, ++it)
 			{
-				child->SetValue(QVariant());
-				child->setParent(nullptr);
-				delete child;
+				addElement(it.value(), it.key(), -1);
 			}
 
-			varChildren.clear();
 			break;
+		}
 
 		case Value:
 			break;
 	}
 
-	type = Value;
+	materializing = false;
+
+	if (nullptr != set)
+	{
+		int insertIndex = (nullptr != placeholder)
+			? set->childProperties().indexOf(placeholder)
+			: -1;
+
+		set->addChildProperties(properties, true, insertIndex);
+		UpdatePlaceholder();
+	}
 }
 
-QVariant VarProperty::CreateVariant() const
+int VarProperty::GetSourceCount() const
+{
+	switch (type)
+	{
+		case List:
+			return value.toList().size();
+
+		case Map:
+			return value.toMap().size();
+
+		case Value:
+			break;
+	}
+
+	return 0;
+}
+
+void VarProperty::BeginUpdate()
+{
+	Materialize();
+	materializing = true;
+}
+
+void VarProperty::EndUpdate()
+{
+	materializing = false;
+	UpdateValue();
+}
+
+void VarProperty::UpdateValue()
 {
 	switch (type)
 	{
 		case List:
 		{
 			QVariantList list;
+			list.reserve(int(varChildren.size()));
 
 			for (auto child : varChildren)
 			{
-				list.append(child->CreateVariant());
+				list.append(child->value);
 			}
 
-			return QVariant(list);
+			value = list;
+			break;
 		}
 
 		case Map:
@@ -286,31 +440,157 @@ QVariant VarProperty::CreateVariant() const
 
 			for (auto child : varChildren)
 			{
-				map.insert(child->name, child->CreateVariant());
+				map.insert(child->name, child->value);
 			}
 
-			return QVariant(map);
+			value = map;
+			break;
 		}
 
-		default:
+		case Value:
 			break;
 	}
 
+	if (nullptr != varParent)
+		varParent->UpdateChildValue(this);
+}
+
+void VarProperty::UpdateChildValue(VarProperty *child)
+{
+	// value is released before modification,
+	// so only containers shared with someone else are copied
+	switch (type)
+	{
+		case List:
+		{
+			auto list = value.toList();
+			value.clear();
+
+			Q_ASSERT(child->index >= 0 && child->index < list.size());
+			list[child->index] = child->value;
+
+			value = list;
+			break;
+		}
+
+		case Map:
+		{
+			auto map = value.toMap();
+			value.clear();
+
+			map.insert(child->name, child->value);
+
+			value = map;
+			break;
+		}
+
+		case Value:
+			return;
+	}
+
+	if (nullptr != varParent)
+		varParent->UpdateChildValue(this);
+}
+
+void VarProperty::UpdatePlaceholder()
+{
+	auto set = qobject_cast<QtnPropertySet *>(parent());
+
+	if (nullptr == set)
+		return;
+
+	int pending = GetSourceCount() - int(varChildren.size());
+
+	if (pending <= 0)
+	{
+		if (nullptr != placeholder)
+		{
+			set->removeChildProperty(placeholder);
+			delete placeholder;
+			placeholder = nullptr;
+		}
+
+		return;
+	}
+
+	if (nullptr == placeholder)
+	{
+		placeholder = new QtnPropertyButton(nullptr);
+		placeholder->setName(QStringLiteral("..."));
+		placeholder->setState(QtnPropertyStateNonSerialized);
+
+		// materialization deletes the button, so it is deferred
+		QObject::connect(placeholder, &QtnPropertyButton::click, this, [this]() {
+			QTimer::singleShot(
+				0, this, [this]() { Materialize(LAZY_CHUNK_SIZE); });
+		});
+
+		// keep button enabled in read-only mode
+		QObject::connect(placeholder, &QtnPropertyButton::preDrawButton,
+			[](const QtnPropertyButton *, QStyleOptionButton *option) {
+				option->state |= QStyle::State_Enabled;
+			});
+
+		set->addChildProperty(placeholder);
+	}
+
+	placeholder->setDisplayName(tr("%1 more").arg(pending));
+	placeholder->setDelegateAttribute(qtnTitleAttr(),
+		tr("Show %1").arg(qMin(pending, int(LAZY_CHUNK_SIZE))));
+}
+
+void VarProperty::SetValue(const QVariant &value)
+{
+	for (auto child : varChildren)
+	{
+		child->varParent = nullptr;
+		child->SetValue(QVariant());
+
+		auto property = qobject_cast<QtnPropertyBase *>(child->parent());
+
+		if (nullptr != property && property->getVarProperty() == child)
+			property->setVarProperty(nullptr);
+
+		child->setParent(nullptr);
+		delete child;
+	}
+
+	varChildren.clear();
+	registerProperty = nullptr;
+	placeholder = nullptr;
+
+	this->value = value;
+	type = Value;
+
+	if (nullptr != varParent)
+		varParent->UpdateChildValue(this);
+}
+
+QVariant VarProperty::CreateVariant() const
+{
 	return value;
 }
 
 bool VarProperty::IsChildNameAvailable(
 	const QString &name, VarProperty *skip) const
 {
+	bool skipped = false;
+
 	for (auto prop : varChildren)
 	{
-		if (skip == prop)
+		if (prop->name != name)
 			continue;
 
-		if (prop->name == name)
+		if (skip != prop)
 			return false;
+
+		skipped = true;
 	}
 
+	// elements which are not materialized yet
+	if (Map == type && !skipped)
+		return !value.toMap().contains(name);
+
 	return true;
 }
 
@@ -333,14 +613,14 @@ QtnPropertyBase *VarProperty::NewExtraProperty(QtnPropertySet *set,
 		case QVariant::Map:
 		{
 			return NewExtraPropertySet(
-				set, value.toMap(), mapParent, name, index, registerProperty);
+				set, Map, value, mapParent, name, index, registerProperty);
 		}
 
 		case QVariant::StringList:
 		case QVariant::List:
 		{
-			return NewExtraPropertyList(
-				set, value.toList(), mapParent, name, index, registerProperty);
+			return NewExtraPropertySet(
+				set, List, value, mapParent, name, index, registerProperty);
 		}
 
 		case QVariant::Int:
@@ -433,8 +713,8 @@ bool VarProperty::PropertyValueAccept(
 		case VarProperty::PID_EXTRA_FLOAT:
 		case VarProperty::PID_EXTRA_BOOL:
 		{
-			auto var_property = property->findChild<VarProperty *>(
-				QString(), Qt::FindDirectChildrenOnly);
+			auto var_property = property->getVarProperty();
+			Q_ASSERT(nullptr != var_property);
 
 			QVariant value;
 
@@ -483,8 +763,9 @@ bool VarProperty::PropertyValueAccept(
 }
 
 QtnPropertySet *VarProperty::NewExtraPropertySet(QtnPropertySet *parent,
-	const QVariantMap &map, VarProperty *mapParent, const QString &name,
-	int index, const RegisterPropertyCallback &registerProperty)
+	Type type, const QVariant &value, VarProperty *mapParent,
+	const QString &name, int index,
+	const RegisterPropertyCallback &registerProperty)
 {
 	auto set = new QtnPropertySet(parent);
 	if (parent)
@@ -492,56 +773,43 @@ QtnPropertySet *VarProperty::NewExtraPropertySet(QtnPropertySet *parent,
 		parent->addChildProperty(set);
 	}
 
-	auto varprop =
-		new VarProperty(set, VarProperty::Map, name, index, QVariant());
+	auto varprop = new VarProperty(set, type, name, index, value);
+	varprop->registerProperty = registerProperty;
 
 	if (nullptr != mapParent)
 		mapParent->AddChild(varprop, index);
-
-	mapParent = varprop;
+	else
+		varprop->eagerBudget = EAGER_BUDGET;
 
 	set->setId(PID_EXTRA);
 	set->setName(name);
 
-	for (auto it = map.begin(); it != map.end(); ++it)
-	{
-		auto &key = it.key();
-		auto &value = it.value();
+	// Containers created by the user or at the top level are expanded.
+	// Nested ones are expanded while the budget of the top parent allows.
+	int count = qMin(varprop->GetSourceCount(), int(LAZY_CHUNK_SIZE));
+	auto top = varprop->TopParent();
 
-		NewExtraProperty(set, value, key, -1, mapParent, registerProperty);
-	}
-
-	return set;
-}
-
-QtnPropertySet *VarProperty::NewExtraPropertyList(QtnPropertySet *parent,
-	const QVariantList &list, VarProperty *mapParent, const QString &name,
-	int index, const RegisterPropertyCallback &registerProperty)
-{
-	auto set = new QtnPropertySet(parent);
-	if (parent)
+	if (nullptr == mapParent || !mapParent->materializing ||
+		top->eagerBudget >= count)
 	{
-		parent->addChildProperty(set);
-	}
-
-	auto varprop =
-		new VarProperty(set, VarProperty::List, name, index, QVariant());
-
-	if (nullptr != mapParent)
-		mapParent->AddChild(varprop, index);
-
-	mapParent = varprop;
-
-	set->setId(PID_EXTRA);
-	set->setName(name);
-
-	int len = list.size();
-
-	for (int i = 0; i < len; i++)
+		top->eagerBudget = qMax(0, top->eagerBudget - count);
+		varprop->Materialize(LAZY_CHUNK_SIZE);
+	} else if (count > 0)
 	{
-		auto &value = list.at(i);
+		set->setCollapsed(true);
+		varprop->UpdatePlaceholder();
 
-		NewExtraProperty(set, value, QString(), i, mapParent, registerProperty);
+		QObject::connect(set, &QtnPropertyBase::propertyDidChange, varprop,
+			[set, varprop](QtnPropertyChangeReason reason) {
+				if ((reason & QtnPropertyChangeReasonStateLocal) &&
+					!set->isCollapsed() && varprop->varChildren.empty())
+				{
+					QTimer::singleShot(0, varprop, [varprop]() {
+						if (varprop->varChildren.empty())
+							varprop->Materialize(LAZY_CHUNK_SIZE);
+					});
+				}
+			});
 	}
 
 	return set;
@@ -27,6 +27,7 @@ limitations under the License.
 class QtnPropertyBase;
 class QtnProperty;
 class QtnPropertySet;
+class QtnPropertyButton;
 
 class QTN_IMPORT_EXPORT VarProperty : public QObject
 {
@@ -45,6 +46,7 @@ public:
 
 	VarProperty(QObject *parent, Type type, const QString &name, int index,
 		const QVariant &value);
+	virtual ~VarProperty() override;
 
 	void ChangePropertyValue(const QVariant &value, QVariant *dest = nullptr);
 	void RemoveFromParent();
@@ -71,8 +73,22 @@ public:
 	VarProperty *TopParent();
 	VarProperty *VarParent();
 	VarChildren &GetChildren();
+	// includes elements which are not materialized yet
 	int GetChildrenCount() const;
 
+	// Lists and maps keep a shared copy of the source value and create
+	// child properties in chunks, when expanded or by "Show More" button.
+	// Any structural change materializes all remaining children.
+	// Edits are written through to values of all parents, detaching
+	// only containers on the path.
+	bool IsMaterialized() const;
+	void Materialize(int count = -1);
+
+	// Adding several children between BeginUpdate and EndUpdate
+	// rebuilds the value once.
+	void BeginUpdate();
+	void EndUpdate();
+
 	void SetValue(const QVariant &value);
 	QVariant CreateVariant() const;
 	bool IsChildNameAvailable(const QString &name, VarProperty *skip) const;
@@ -98,18 +114,33 @@ public:
 		PID_EXTRA_TOTAL
 	};
 
+	enum
+	{
+		// children created per materialization step
+		LAZY_CHUNK_SIZE = 1000,
+		// total children materialized eagerly for nested containers
+		EAGER_BUDGET = 4096
+	};
+
 private:
 	static QtnPropertySet *NewExtraPropertySet(QtnPropertySet *parent,
-		const QVariantMap &map, VarProperty *mapParent, const QString &name,
-		int index, const RegisterPropertyCallback &registerProperty);
-	static QtnPropertySet *NewExtraPropertyList(QtnPropertySet *parent,
-		const QVariantList &list, VarProperty *mapParent, const QString &name,
-		int index, const RegisterPropertyCallback &registerProperty);
+		Type type, const QVariant &value, VarProperty *mapParent,
+		const QString &name, int index,
+		const RegisterPropertyCallback &registerProperty);
+
+	int GetSourceCount() const;
+	void UpdateValue();
+	void UpdateChildValue(VarProperty *child);
+	void UpdatePlaceholder();
 
 	VarProperty *varParent;
 	VarChildren varChildren;
 	QVariant value;
 	QString name;
+	RegisterPropertyCallback registerProperty;
+	QtnPropertyButton *placeholder;
 	int index;
+	int eagerBudget;
 	Type type;
+	bool materializing : 1;
 };
@@ -68,6 +68,7 @@ void QtnPropertySetTest1::init()
     setDescription(description);
     setId(1);
     setState(0);
+    internMetadata();
     
     // start children initialization
     static QString a_name = QStringLiteral("a");
@@ -78,6 +79,7 @@ void QtnPropertySetTest1::init()
     a.setMaxValue(10);
     a.setStepValue(-1);
     a.setValue(5);
+    a.internMetadata();
     static QString text_name = QStringLiteral("text");
     text.setName(text_name);
     static QString text_description = "defrf\"sde\"""deerf3rf"
@@ -86,6 +88,7 @@ void QtnPropertySetTest1::init()
     text.setDescription(text_description);
     text.setId(3);
     text.setValue(QString("#^{};"));
+    text.internMetadata();
     // end children initialization
 }
 
@@ -150,6 +153,7 @@ void QtnPropertySetTest2::init()
     static QString Test2_name = QStringLiteral("Test2");
     setName(Test2_name);
     setId(4);
+    internMetadata();
 }
 
 void QtnPropertySetTest2::connectSlots()
@@ -229,13 +233,16 @@ void QtnPropertySetYY::init()
     static QString description = QString("ss")+QString("ss");
     setDescription(description);
     setId(6);
+    internMetadata();
     
     // start children initialization
     static QString rect_name = QStringLiteral("rect");
     rect.setName(rect_name);
     rect.setValue(QRect(10, 10, 10, 10));
+    rect.internMetadata();
     static QString s_name = QStringLiteral("s");
     s.setName(s_name);
+    s.internMetadata();
     // end children initialization
 }
 
@@ -300,6 +307,7 @@ void QtnPropertySetAA::init()
     static QString aa_name = QStringLiteral("aa");
     setName(aa_name);
     setId(9);
+    internMetadata();
 }
 
 void QtnPropertySetAA::connectSlots()
@@ -377,15 +385,18 @@ void QtnPropertySetSS::init()
     static QString iis_name = QStringLiteral("iis");
     setName(iis_name);
     setId(7);
+    internMetadata();
     
     // start children initialization
     static QString a_name = QStringLiteral("a");
     a.setName(a_name);
     a.setId(8);
     a.setValue(true);
+    a.internMetadata();
     static QString aa_name = QStringLiteral("aa");
     aa.setName(aa_name);
     aa.setId(9);
+    aa.internMetadata();
     // end children initialization
 }
 
@@ -491,6 +502,7 @@ void QtnPropertySetTest3::init()
     static QString Test3_name = QStringLiteral("Test3");
     setName(Test3_name);
     setId(5);
+    internMetadata();
     
     // start children initialization
     static QString yy_name = QStringLiteral("yy");
@@ -498,23 +510,30 @@ void QtnPropertySetTest3::init()
     static QString yy_description = QString("ss")+QString("ss");
     yy.setDescription(yy_description);
     yy.setId(6);
+    yy.internMetadata();
     static QString iis_name = QStringLiteral("iis");
     iis.setName(iis_name);
     iis.setId(7);
+    iis.internMetadata();
     static QString u_name = QStringLiteral("u");
     u.setName(u_name);
     u.setId(10);
     u.setValue(true);
+    u.internMetadata();
     static QString xx_name = QStringLiteral("xx");
     xx.setName(xx_name);
+    xx.internMetadata();
     static QString tt_name = QStringLiteral("tt");
     tt.setName(tt_name);
+    tt.internMetadata();
     static QString s_name = QStringLiteral("s");
     s.setName(s_name);
     s.a.setValue(false);
+    s.internMetadata();
     static QString ww_name = QStringLiteral("ww");
     ww.setName(ww_name);
     ww.setId(11);
+    ww.internMetadata();
     static QString bc_name = QStringLiteral("bc");
     bc.setName(bc_name);
     bc.setCallbackValueAccepted([](bool value)->bool {
@@ -532,6 +551,7 @@ void QtnPropertySetTest3::init()
             m_s = value;
         });
     bc.setId(12);
+    bc.internMetadata();
     // end children initialization
 }
 
@@ -964,147 +984,181 @@ void QtnPropertySetAllPropertyTypes::init()
     static QString AllPropertyTypes_name = QStringLiteral("AllPropertyTypes");
     setName(AllPropertyTypes_name);
     setId(13);
+    internMetadata();
     
     // start children initialization
     static QString bp_name = QStringLiteral("bp");
     bp.setName(bp_name);
     bp.setId(14);
+    bp.internMetadata();
     static QString bpc_name = QStringLiteral("bpc");
     bpc.setName(bpc_name);
     bpc.setCallbackValueGet([this]() { return _b; });
     bpc.setCallbackValueSet([this](bool v, QtnPropertyChangeReason /*reason*/) { _b = v; });
     bpc.setId(15);
+    bpc.internMetadata();
     static QString ip_name = QStringLiteral("ip");
     ip.setName(ip_name);
     ip.setId(16);
+    ip.internMetadata();
     static QString ipc_name = QStringLiteral("ipc");
     ipc.setName(ipc_name);
     ipc.setCallbackValueGet([this]() { return _i; });
     ipc.setCallbackValueSet([this](qint32 v, QtnPropertyChangeReason /*reason*/) { _i =v; });
     ipc.setId(17);
+    ipc.internMetadata();
     static QString up_name = QStringLiteral("up");
     up.setName(up_name);
     up.setId(18);
+    up.internMetadata();
     static QString upc_name = QStringLiteral("upc");
     upc.setName(upc_name);
     upc.setCallbackValueGet([this]() { return _ui; });
     upc.setCallbackValueSet([this](quint32 v, QtnPropertyChangeReason /*reason*/) { _ui = v; });
     upc.setId(19);
+    upc.internMetadata();
     static QString fp_name = QStringLiteral("fp");
     fp.setName(fp_name);
     fp.setId(20);
+    fp.internMetadata();
     static QString fpc_name = QStringLiteral("fpc");
     fpc.setName(fpc_name);
     fpc.setCallbackValueGet([this]() { return _f; });
     fpc.setCallbackValueSet([this](float v, QtnPropertyChangeReason /*reason*/) { _f = v; });
     fpc.setId(21);
+    fpc.internMetadata();
     static QString dp_name = QStringLiteral("dp");
     dp.setName(dp_name);
     dp.setId(22);
+    dp.internMetadata();
     static QString dpc_name = QStringLiteral("dpc");
     dpc.setName(dpc_name);
     dpc.setCallbackValueGet([this]() { return _d; });
     dpc.setCallbackValueSet([this](double v, QtnPropertyChangeReason /*reason*/) { _d = v; });
     dpc.setId(23);
+    dpc.internMetadata();
     static QString sp_name = QStringLiteral("sp");
     sp.setName(sp_name);
     sp.setId(24);
+    sp.internMetadata();
     static QString spc_name = QStringLiteral("spc");
     spc.setName(spc_name);
     spc.setCallbackValueGet([this]() { return _s; });
     spc.setCallbackValueSet([this](QString v, QtnPropertyChangeReason /*reason*/) { _s = v; });
     spc.setId(25);
+    spc.internMetadata();
     static QString rp_name = QStringLiteral("rp");
     rp.setName(rp_name);
     rp.setId(26);
+    rp.internMetadata();
     static QString rpc_name = QStringLiteral("rpc");
     rpc.setName(rpc_name);
     rpc.setCallbackValueGet([this]() { return _r; });
     rpc.setCallbackValueSet([this](QRect v, QtnPropertyChangeReason /*reason*/) { _r = v; });
     rpc.setId(27);
+    rpc.internMetadata();
     static QString pp_name = QStringLiteral("pp");
     pp.setName(pp_name);
     pp.setId(28);
+    pp.internMetadata();
     static QString ppc_name = QStringLiteral("ppc");
     ppc.setName(ppc_name);
     ppc.setCallbackValueGet([this]() { return _p; });
     ppc.setCallbackValueSet([this](QPoint v, QtnPropertyChangeReason /*reason*/) { _p = v; });
     ppc.setId(29);
+    ppc.internMetadata();
     static QString szp_name = QStringLiteral("szp");
     szp.setName(szp_name);
     szp.setId(30);
+    szp.internMetadata();
     static QString szpc_name = QStringLiteral("szpc");
     szpc.setName(szpc_name);
     szpc.setCallbackValueGet([this]() { return _sz; });
     szpc.setCallbackValueSet([this](QSize v, QtnPropertyChangeReason /*reason*/) { _sz = v; });
     szpc.setId(31);
+    szpc.internMetadata();
     static QString ep_name = QStringLiteral("ep");
     ep.setName(ep_name);
     ep.setEnumInfo(&COLOR::info());
     ep.setId(32);
     ep.setValue(COLOR::BLUE);
+    ep.internMetadata();
     static QString epc_name = QStringLiteral("epc");
     epc.setName(epc_name);
     epc.setCallbackValueGet([this]() { return _e; });
     epc.setCallbackValueSet([this](QtnEnumValueType v, QtnPropertyChangeReason /*reason*/) { _e = v; });
     epc.setEnumInfo(&COLOR::info());
     epc.setId(33);
+    epc.internMetadata();
     static QString efp_name = QStringLiteral("efp");
     efp.setName(efp_name);
     efp.setEnumInfo(&MASK::info());
     efp.setId(34);
     efp.setValue(MASK::ONE|MASK::FOUR);
+    efp.internMetadata();
     static QString efpc_name = QStringLiteral("efpc");
     efpc.setName(efpc_name);
     efpc.setCallbackValueGet([this]() { return _ef; });
     efpc.setCallbackValueSet([this](QtnEnumFlagsValueType v, QtnPropertyChangeReason /*reason*/) { _ef = v; });
     efpc.setEnumInfo(&MASK::info());
     efpc.setId(35);
+    efpc.internMetadata();
     static QString cp_name = QStringLiteral("cp");
     cp.setName(cp_name);
     cp.setId(36);
     cp.setValue(QColor(Qt::blue));
+    cp.internMetadata();
     static QString cpc_name = QStringLiteral("cpc");
     cpc.setName(cpc_name);
     cpc.setCallbackValueGet([this]() { return _cl; });
     cpc.setCallbackValueSet([this](QColor v, QtnPropertyChangeReason /*reason*/) { _cl = v; });
     cpc.setId(37);
+    cpc.internMetadata();
     static QString fnp_name = QStringLiteral("fnp");
     fnp.setName(fnp_name);
     fnp.setId(38);
     fnp.setValue(QFont("Courier", 10));
+    fnp.internMetadata();
     static QString fnpc_name = QStringLiteral("fnpc");
     fnpc.setName(fnpc_name);
     fnpc.setCallbackValueGet([this]() { return _fn; });
     fnpc.setCallbackValueSet([this](QFont v, QtnPropertyChangeReason /*reason*/) { _fn = v; });
     fnpc.setId(39);
+    fnpc.internMetadata();
     static QString bttn_name = QStringLiteral("bttn");
     bttn.setName(bttn_name);
     bttn.setId(40);
+    bttn.internMetadata();
     static QString ppf_name = QStringLiteral("ppf");
     ppf.setName(ppf_name);
     ppf.setId(41);
+    ppf.internMetadata();
     static QString ppfc_name = QStringLiteral("ppfc");
     ppfc.setName(ppfc_name);
     ppfc.setCallbackValueGet([this]() { return _pf; });
     ppfc.setCallbackValueSet([this](QPointF v, QtnPropertyChangeReason /*reason*/) { _pf = v; });
     ppfc.setId(42);
+    ppfc.internMetadata();
     static QString rpf_name = QStringLiteral("rpf");
     rpf.setName(rpf_name);
     rpf.setId(43);
+    rpf.internMetadata();
     static QString rpfc_name = QStringLiteral("rpfc");
     rpfc.setName(rpfc_name);
     rpfc.setCallbackValueGet([this]() { return _rf; });
     rpfc.setCallbackValueSet([this](QRectF v, QtnPropertyChangeReason /*reason*/) { _rf = v; });
     rpfc.setId(44);
+    rpfc.internMetadata();
     static QString szpf_name = QStringLiteral("szpf");
     szpf.setName(szpf_name);
     szpf.setId(45);
+    szpf.internMetadata();
     static QString szpfc_name = QStringLiteral("szpfc");
     szpfc.setName(szpfc_name);
     szpfc.setCallbackValueGet([this]() { return _szf; });
     szpfc.setCallbackValueSet([this](QSizeF v, QtnPropertyChangeReason /*reason*/) { _szf = v; });
     szpfc.setId(46);
+    szpfc.internMetadata();
     // end children initialization
 }
 
@@ -1190,12 +1244,14 @@ void QtnPropertySetTest12::init()
 {
     static QString Test12_name = QStringLiteral("Test12");
     setName(Test12_name);
+    internMetadata();
     
     // start children initialization
     static QString p_name = QStringLiteral("p");
     p.setName(p_name);
     p.setEnumInfo(&MY_TYPE::info());
     p.setValue(MY_TYPE::MY_TYPE1);
+    p.internMetadata();
     // end children initialization
 }
 
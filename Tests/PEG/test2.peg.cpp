@@ -57,6 +57,7 @@ void QtnPropertySetA::init()
     static QString A_name = QStringLiteral("A");
     setName(A_name);
     setId(50);
+    internMetadata();
     
     // start children initialization
     static QString b_name = QStringLiteral("b");
@@ -65,6 +66,7 @@ void QtnPropertySetA::init()
     b.setDescription(b_description);
     b.setId(51);
     b.setValue(true);
+    b.internMetadata();
     // end children initialization
 }
 
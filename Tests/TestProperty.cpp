@@ -1,8 +1,24 @@
 #include "TestProperty.h"
 #include "QtnProperty/QObjectPropertySet.h"
+#include "QtnProperty/Auxiliary/PropertyNumber.h"
+#include "QtnProperty/VarProperty.h"
+#include "QtnProperty/Delegates/PropertyDelegateFactory.h"
+#include "QtnProperty/Delegates/Core/PropertyDelegateBool.h"
+#include "QtnProperty/Delegates/Core/PropertyDelegateEnumFlags.h"
+#include "QtnProperty/PropertyDelegateAttrs.h"
+#include "QtnProperty/PropertyView.h"
+#include "QtnProperty/Utils/QtnUpdateCoalescer.h"
+#include "QtnProperty/Utils/QtnRowLayout.h"
+#include "QtnProperty/Utils/QtnAnimationClock.h"
+#include "QtnProperty/Auxiliary/PropertyEnumRegistry.h"
 #include "PEG/test.peg.h"
 #include <QtTest/QtTest>
 #include <QtScript/QScriptEngine>
+#include <QWidget>
+
+#include <cmath>
+#include <memory>
+#include <thread>
 
 static bool ret_true()
 {
@@ -139,6 +155,35 @@ void TestProperty::description()
 	QCOMPARE(p1.description(), QString("Another description\nwith multiline."));
 }
 
+void TestProperty::metadata()
+{
+	QtnPropertySetTest1 p1(this);
+	QtnPropertySetTest1 p2(this);
+	QVERIFY(p1.metadata().isSharedWith(p2.metadata()));
+	QVERIFY(p1.a.metadata().isSharedWith(p2.a.metadata()));
+	QCOMPARE(p2.a.description(), QString("Descripion"));
+
+	p1.a.setDescription("Changed");
+	QVERIFY(!p1.a.metadata().isSharedWith(p2.a.metadata()));
+	QCOMPARE(p1.a.description(), QString("Changed"));
+	QCOMPARE(p2.a.description(), QString("Descripion"));
+	QCOMPARE(p1.a.displayName(), QString("a"));
+
+	QtnPropertyBool p3(this);
+	p3.setName("a");
+	p3.setMetadata(p2.a.metadata());
+	QVERIFY(p3.metadata().isSharedWith(p2.a.metadata()));
+	QCOMPARE(p3.description(), QString("Descripion"));
+
+	p3.setDescription("Changed");
+	QCOMPARE(p3.metadata(), p1.a.metadata());
+	QVERIFY(!p3.metadata().isSharedWith(p1.a.metadata()));
+
+	p1.a.internMetadata();
+	p3.internMetadata();
+	QVERIFY(p3.metadata().isSharedWith(p1.a.metadata()));
+}
+
 void TestProperty::id()
 {
 	QtnPropertySet p(nullptr);
@@ -289,6 +334,53 @@ void TestProperty::propertyDelegateCallback()
 	QVERIFY(p.delegateInfo()->attributes["color"] == QColor(Qt::black));
 }
 
+void TestProperty::propertyDelegateFactory()
+{
+	QtnPropertyBool p(this);
+
+	int superCalls = 0;
+	int calls = 0;
+	auto create = [](int &counter) {
+		return [&counter](QtnPropertyBase &owner) -> QtnPropertyDelegate * {
+			counter++;
+			return qtnCreateDelegate<QtnPropertyDelegateBoolCheck,
+				QtnPropertyBoolBase>(owner);
+		};
+	};
+
+	QtnPropertyDelegateFactory superFactory;
+	QtnPropertyDelegateFactory factory(&superFactory);
+	superFactory.registerDelegateDefault(
+		&QtnPropertyBoolBase::staticMetaObject, create(superCalls));
+
+	QScopedPointer<QtnPropertyDelegate> delegate(factory.createDelegate(p));
+	QVERIFY(dynamic_cast<QtnPropertyDelegateBoolCheck *>(delegate.data()));
+	delegate.reset(factory.createDelegate(p));
+	QCOMPARE(superCalls, 2);
+
+	// base class delegate of sub-factory is preferred
+	factory.registerDelegateDefault(
+		&QtnPropertyBase::staticMetaObject, create(calls));
+	delegate.reset(factory.createDelegate(p));
+	QCOMPARE(calls, 1);
+	QCOMPARE(superCalls, 2);
+
+	factory.unregisterDelegate(&QtnPropertyBase::staticMetaObject);
+	delegate.reset(factory.createDelegate(p));
+	QCOMPARE(calls, 1);
+	QCOMPARE(superCalls, 3);
+
+	// named delegate
+	QtnPropertyDelegateInfo info;
+	info.name = "Named";
+	p.setDelegateInfo(info);
+	superFactory.registerDelegate(
+		&QtnPropertyBoolBase::staticMetaObject, create(calls), "Named");
+	delegate.reset(factory.createDelegate(p));
+	QCOMPARE(calls, 2);
+	QCOMPARE(superCalls, 3);
+}
+
 void TestProperty::propertyBool()
 {
 	{
@@ -564,6 +656,36 @@ void TestProperty::propertySet()
 	res = p.findChildProperties("pp.b");
 	QCOMPARE(res.size(), 1);
 	QCOMPARE(res[0], &b);
+
+	// path indexes split paths the same way
+	QVector<QStringRef> segments;
+	QString path("pp. b");
+	res = p.findChildProperties(path);
+	QCOMPARE(res.size(), 1);
+	QCOMPARE(res[0], &b);
+	QVERIFY(qtnSplitPropertyPath(QStringRef(&path), segments));
+	QCOMPARE(segments.size(), 2);
+	QCOMPARE(segments.at(1).toString(), QString("b"));
+
+	path = "pp .b";
+	res = p.findChildProperties(path);
+	QCOMPARE(res.size(), 1);
+	QCOMPARE(res[0], &b);
+	QVERIFY(qtnSplitPropertyPath(QStringRef(&path), segments));
+	QCOMPARE(segments.at(0).toString(), QString("pp"));
+
+	path = "pp. .b";
+	QVERIFY(!qtnSplitPropertyPath(QStringRef(&path), segments));
+
+	// view item index resolves the same properties
+	QtnPropertyView view(nullptr, &p);
+	for (auto viewPath : { "pp", "pp.b", "pp. b", "pp .b", " pp . b ", "pp. .b",
+			 "b", "f", "pp.f" })
+	{
+		res = p.findChildProperties(viewPath);
+		QCOMPARE(view.findProperty(viewPath),
+			res.size() == 1 ? res.at(0) : nullptr);
+	}
 }
 
 static void testSerializationState(QtnPropertyBase &p)
@@ -1629,6 +1751,18 @@ void TestProperty::stringConversions()
 		QCOMPARE(p.u.value(), false);
 		QCOMPARE(p.yy.s.value(), QString("new value"));
 		QCOMPARE(p.s.a.value(), true);
+
+		// "a" is found both in "iis" and "s"
+		QVERIFY(!p.fromStr("a = false"));
+		QCOMPARE(p.iis.a.value(), false);
+		QCOMPARE(p.s.a.value(), true);
+		QVERIFY(!p.fromStr("iis..a = true"));
+		QVERIFY(!p.fromStr(" = true"));
+		// segments are trimmed, like in findChildProperties
+		QVERIFY(p.fromStr(" iis . a = true "));
+		QCOMPARE(p.iis.a.value(), true);
+		QVERIFY(p.fromStr(" iis .a = false"));
+		QCOMPARE(p.iis.a.value(), false);
 	}
 
 	{
@@ -1668,6 +1802,584 @@ void TestProperty::stringConversions()
 	}
 }
 
+void TestProperty::cborConversions()
+{
+#ifdef QTN_CBOR_SUPPORT
+	QtnPropertySetAllPropertyTypes pp(this);
+
+	QByteArray data;
+	QVERIFY(pp.toCbor(data));
+	QVERIFY(!data.isEmpty());
+
+	modify(pp);
+	verifyModified(pp);
+
+	QVERIFY(pp.fromCbor(data));
+	verifyInitialValues(pp);
+
+	modify(pp);
+
+	QByteArray namedData;
+	QVERIFY(pp.toCbor(namedData, true));
+
+	QtnPropertySetAllPropertyTypes pp1(this);
+	verifyInitialValues(pp1);
+	QVERIFY(pp1.fromCbor(namedData));
+	verifyModified(pp1);
+
+	QVERIFY(!pp1.fromCbor(QByteArray("garbage")));
+#else
+	QSKIP("CBOR support requires Qt 5.12");
+#endif
+}
+
+static QVector<double> numberSamples()
+{
+	QVector<double> result = { 0.0, -0.0, 1.0, -1.0, 0.1, 0.5, 1e-5, 1e15,
+		1e16, 1e20, -1e-300, 123456789.0, 3.14159265358979,
+		std::numeric_limits<double>::max(),
+		std::numeric_limits<double>::min(),
+		std::numeric_limits<double>::denorm_min(),
+		std::numeric_limits<double>::infinity(),
+		-std::numeric_limits<double>::infinity() };
+
+	quint64 seed = 1;
+	for (int i = 0; i < 1000; i++)
+	{
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		double mantissa = double(seed >> 11) / double(1ULL << 53);
+		int exponent = int((seed >> 3) % 80) - 40;
+		if (seed & 1)
+			mantissa = -mantissa;
+		result.append(mantissa * std::pow(10.0, exponent));
+	}
+
+	return result;
+}
+
+void TestProperty::numberConversions()
+{
+	QVector<qint64> ints = { 0, 1, -1, 9, 10, -10, 2147483647LL, -2147483648LL,
+		std::numeric_limits<qint64>::max(),
+		std::numeric_limits<qint64>::min() };
+
+	for (auto value : ints)
+	{
+		QCOMPARE(qtnNumberToStr(value), QString::number(value));
+		QCOMPARE(qtnNumberToStr(quint64(value)), QString::number(quint64(value)));
+		QCOMPARE(qtnNumberToStr(qint32(value)), QString::number(qint32(value)));
+	}
+
+	for (auto value : numberSamples())
+	{
+		QCOMPARE(qtnNumberToStr(value), QString::number(value, 'g', 15));
+		QCOMPARE(qtnNumberToStr(float(value)),
+			QString::number(float(value), 'g', 6));
+
+		QString str;
+		qtnAppendNumber(str, value, QtnArgDoublePrecision);
+		QCOMPARE(str, QString("%1").arg(value));
+
+		str = QString::number(value, 'g', 17);
+		double parsed = 0.0;
+		QVERIFY(qtnStrToNumber(str, parsed));
+		QCOMPARE(parsed, str.toDouble());
+	}
+
+	QCOMPARE(qtnNumberToStr(std::numeric_limits<double>::quiet_NaN()),
+		QString::number(std::numeric_limits<double>::quiet_NaN(), 'g', 15));
+
+	QStringList intStrings = { "0", "+12", " 42 ", "-2147483648", "2147483647",
+		"2147483648", "4294967295", "4294967296", "-1", "9223372036854775807",
+		"9223372036854775808", "-9223372036854775808", "18446744073709551615",
+		"18446744073709551616", "", " ", "-", "+", "12a", "1 2", "0x10",
+		"1.5" };
+
+	for (auto &str : intStrings)
+	{
+		bool ok = false;
+		qint32 i32 = 0;
+		auto expectedInt = str.toInt(&ok);
+		QCOMPARE(qtnStrToNumber(str, i32), ok);
+		if (ok)
+			QCOMPARE(i32, expectedInt);
+
+		quint32 u32 = 0;
+		auto expectedUInt = str.toUInt(&ok);
+		QCOMPARE(qtnStrToNumber(str, u32), ok);
+		if (ok)
+			QCOMPARE(u32, expectedUInt);
+
+		qint64 i64 = 0;
+		auto expectedInt64 = str.toLongLong(&ok);
+		QCOMPARE(qtnStrToNumber(str, i64), ok);
+		if (ok)
+			QCOMPARE(i64, expectedInt64);
+
+		quint64 u64 = 0;
+		auto expectedUInt64 = str.toULongLong(&ok);
+		QCOMPARE(qtnStrToNumber(str, u64), ok);
+		if (ok)
+			QCOMPARE(u64, expectedUInt64);
+	}
+
+	QStringList doubleStrings = { "0", "1.5", " -2e10 ", "+3", ".5",
+		"1e-5", "1E+20", "3.40282e+39", "", "+-3", "abc", "32.ws", "1,5",
+		"1e" };
+
+	for (auto &str : doubleStrings)
+	{
+		bool ok = false;
+		double d = 0.0;
+		auto expectedDouble = str.toDouble(&ok);
+		QCOMPARE(qtnStrToNumber(str, d), ok);
+		if (ok)
+			QCOMPARE(d, expectedDouble);
+
+		float f = 0.f;
+		auto expectedFloat = str.toFloat(&ok);
+		QCOMPARE(qtnStrToNumber(str, f), ok);
+		if (ok)
+			QCOMPARE(f, expectedFloat);
+	}
+}
+
+void TestProperty::numberConversionsBenchmark_data()
+{
+	QTest::addColumn<bool>("qt");
+
+	QTest::newRow("QString") << true;
+	QTest::newRow("qtnNumber") << false;
+}
+
+void TestProperty::numberConversionsBenchmark()
+{
+	QFETCH(bool, qt);
+
+	auto samples = numberSamples();
+	QStringList expected;
+	for (auto value : samples)
+		expected.append(QString::number(value, 'g', 15));
+
+	QStringList result;
+	QBENCHMARK
+	{
+		result.clear();
+		for (auto value : samples)
+		{
+			QString str;
+			if (qt)
+			{
+				str = QString::number(value, 'g', 15);
+				str.toDouble();
+			} else
+			{
+				str = qtnNumberToStr(value);
+				double parsed;
+				qtnStrToNumber(str, parsed);
+			}
+			result.append(str);
+		}
+	}
+
+	QCOMPARE(result, expected);
+}
+
+void TestProperty::stringParsers()
+{
+	int errorPos = -1;
+
+	QRect rect;
+	QVERIFY(QtnPropertyQRect::rectFromStr(
+		"QRect(1, 2, 3, 4)", rect, &errorPos));
+	QCOMPARE(rect, QRect(1, 2, 3, 4));
+	QVERIFY(!QtnPropertyQRect::rectFromStr(
+		" QRect (1,2,-3,4)", rect, &errorPos));
+	QCOMPARE(errorPos, 12);
+	QVERIFY(!QtnPropertyQRect::rectFromStr(
+		"QRectF(1, 2, 3, 4)", rect, &errorPos));
+	QCOMPARE(errorPos, 5);
+
+	QRectF rectF;
+	QVERIFY(QtnPropertyQRectF::rectFromStr(
+		"qrectf(-1.5, 2, 3.25, 4)", rectF, &errorPos));
+	QCOMPARE(rectF, QRectF(-1.5, 2, 3.25, 4));
+
+	QPoint point;
+	QVERIFY(QtnPropertyQPoint::pointFromStr("QPoint(-1, 2)", point));
+	QCOMPARE(point, QPoint(-1, 2));
+	QVERIFY(!QtnPropertyQPoint::pointFromStr("QPoint(1, x)", point, &errorPos));
+	QCOMPARE(errorPos, 10);
+	QVERIFY(!QtnPropertyQPoint::pointFromStr(
+		"QPointF(1, 2)", point, &errorPos));
+	QCOMPARE(errorPos, 6);
+
+	QPointF pointF;
+	QVERIFY(QtnPropertyQPointF::pointFromStr("QPointF(1.5, -2.25)", pointF));
+	QCOMPARE(pointF, QPointF(1.5, -2.25));
+
+	QSize size;
+	QVERIFY(!QtnPropertyQSize::sizeFromStr(
+		"QSize(3, 4) tail", size, &errorPos));
+	QCOMPARE(errorPos, 12);
+
+	QSizeF sizeF;
+	QVERIFY(QtnPropertyQSizeF::sizeFromStr("QSizeF(1.5, 2)", sizeF));
+	QCOMPARE(sizeF, QSizeF(1.5, 2));
+
+	QVector3D vector;
+	QVERIFY(QtnPropertyQVector3D::vectorFromStr("QVector3D(1, 2, 3)", vector));
+	QCOMPARE(vector, QVector3D(1, 2, 3));
+	QVERIFY(!QtnPropertyQVector3D::vectorFromStr(
+		"QVector3D(1, 2)", vector, &errorPos));
+	QCOMPARE(errorPos, 14);
+
+	QColor color;
+	QVERIFY(QtnPropertyQColor::colorFromStr("#ff0080", color));
+	QCOMPARE(color, QColor(255, 0, 128));
+	QVERIFY(QtnPropertyQColor::colorFromStr("#f08", color));
+	QCOMPARE(color, QColor(255, 0, 136));
+	QVERIFY(QtnPropertyQColor::colorFromStr("#80ff0000", color));
+	QCOMPARE(color, QColor(255, 0, 0, 128));
+	QVERIFY(!QtnPropertyQColor::colorFromStr("  #ff00g0", color, &errorPos));
+	QCOMPARE(errorPos, 7);
+	QVERIFY(!QtnPropertyQColor::colorFromStr("nocolor", color, &errorPos));
+	QCOMPARE(errorPos, 0);
+	QVERIFY(!QtnPropertyQColor::colorFromStr("", color, &errorPos));
+	QCOMPARE(errorPos, 0);
+
+	QPen pen;
+	QVERIFY(QtnPropertyQPenBase::penFromStr(
+		"#0000ff, DashLine, 3, SquareCap, BevelJoin", pen, &errorPos));
+	QCOMPARE(pen.color(), QColor(Qt::blue));
+	QCOMPARE(pen.style(), Qt::DashLine);
+	QCOMPARE(pen.width(), 3);
+	QCOMPARE(pen.capStyle(), Qt::SquareCap);
+	QCOMPARE(pen.joinStyle(), Qt::BevelJoin);
+	QVERIFY(!QtnPropertyQPenBase::penFromStr(
+		"#0000ff, DashLine, x, SquareCap, BevelJoin", pen, &errorPos));
+	QCOMPARE(errorPos, 19);
+	QVERIFY(!QtnPropertyQPenBase::penFromStr(
+		"#00zzff, DashLine, 3, SquareCap, BevelJoin", pen, &errorPos));
+	QCOMPARE(errorPos, 3);
+	QVERIFY(!QtnPropertyQPenBase::penFromStr(
+		"#0000ff, Dash, 3, SquareCap, BevelJoin", pen, &errorPos));
+	QCOMPARE(errorPos, 9);
+
+	QFont font;
+	QVERIFY(QtnPropertyQFont::fontFromStr(
+		"Arial,18,-1,5,50,0,0,0,0,0", font, &errorPos));
+	QCOMPARE(font.family(), QString("Arial"));
+	QCOMPARE(font.pointSize(), 18);
+	QVERIFY(QtnPropertyQFont::fontFromStr(
+		"Arial,10.5,-1,5,50,0,0,0,0,0", font, &errorPos));
+	QCOMPARE(font.pointSizeF(), 10.5);
+	QVERIFY(!QtnPropertyQFont::fontFromStr("Arial,big", font, &errorPos));
+	QCOMPARE(errorPos, 6);
+	QVERIFY(!QtnPropertyQFont::fontFromStr(
+		"Arial,10,-1.5,5,50,0,0,0,0,0", font, &errorPos));
+	QCOMPARE(errorPos, 9);
+
+	QtnEnumFlagsValueType flags = 0;
+	QVERIFY(QtnPropertyEnumFlags::flagsFromStr(
+		MASK::info(), "ONE | FOUR", flags, &errorPos));
+	QCOMPARE(flags, QtnEnumFlagsValueType(MASK::ONE | MASK::FOUR));
+	QVERIFY(QtnPropertyEnumFlags::flagsFromStr(MASK::info(), " 0 ", flags));
+	QCOMPARE(flags, QtnEnumFlagsValueType(0));
+	QVERIFY(!QtnPropertyEnumFlags::flagsFromStr(
+		MASK::info(), "ONE | SIX", flags, &errorPos));
+	QCOMPARE(errorPos, 6);
+	QVERIFY(!QtnPropertyEnumFlags::flagsFromStr(
+		MASK::info(), "ONE||TWO", flags, &errorPos));
+	QCOMPARE(errorPos, 4);
+
+	// parsers keep no shared state
+	bool threadOk = true;
+	std::thread thread([&threadOk]() {
+		for (int i = 0; i < 1000; i++)
+		{
+			QRect r;
+			if (!QtnPropertyQRect::rectFromStr("QRect(1, 2, 3, 4)", r) ||
+				r != QRect(1, 2, 3, 4))
+			{
+				threadOk = false;
+			}
+		}
+	});
+	for (int i = 0; i < 1000; i++)
+	{
+		QVERIFY(QtnPropertyQRect::rectFromStr("QRect(5, 6, 7, 8)", rect));
+		QCOMPARE(rect, QRect(5, 6, 7, 8));
+	}
+	thread.join();
+	QVERIFY(threadOk);
+}
+
+static QStringList rectSamples()
+{
+	QStringList result;
+	quint64 seed = 1;
+	for (int i = 0; i < 1000; i++)
+	{
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		int left = int(seed % 20001) - 10000;
+		int top = int((seed >> 16) % 20001) - 10000;
+		int width = int((seed >> 32) % 10000);
+		int height = int((seed >> 48) % 10000);
+		result.append(QString("QRect(%1, %2, %3, %4)")
+						  .arg(left)
+						  .arg(top)
+						  .arg(width)
+						  .arg(height));
+	}
+
+	return result;
+}
+
+static bool rectFromStrRegExp(const QString &str, QRect &rect)
+{
+	// the parser QtnPropertyQRect used before QtnStrParser
+	QRegExp parserRect(
+		"^\\s*QRect\\s*\\(([^\\)]+)\\)\\s*$", Qt::CaseInsensitive);
+	QRegExp parserParams(
+		"^\\s*(-?\\d+)\\s*,\\s*(-?\\d+)\\s*,\\s*(\\d+)\\s*,\\s*(\\d+)\\s*$",
+		Qt::CaseInsensitive);
+
+	if (!parserRect.exactMatch(str))
+		return false;
+
+	auto params = parserRect.capturedTexts();
+	if (params.size() != 2 || !parserParams.exactMatch(params[1]))
+		return false;
+
+	params = parserParams.capturedTexts();
+	if (params.size() != 5)
+		return false;
+
+	rect = QRect(params[1].toInt(), params[2].toInt(), params[3].toInt(),
+		params[4].toInt());
+	return true;
+}
+
+void TestProperty::compositeParseBenchmark_data()
+{
+	QTest::addColumn<bool>("regExp");
+
+	QTest::newRow("QRegExp") << true;
+	QTest::newRow("QtnStrParser") << false;
+}
+
+void TestProperty::compositeParseBenchmark()
+{
+	QFETCH(bool, regExp);
+
+	auto samples = rectSamples();
+	QVector<QRect> expected;
+	for (auto &str : samples)
+	{
+		QRect rect;
+		QVERIFY(rectFromStrRegExp(str, rect));
+		expected.append(rect);
+	}
+
+	QVector<QRect> result;
+	QBENCHMARK
+	{
+		result.clear();
+		for (auto &str : samples)
+		{
+			QRect rect;
+			if (regExp)
+				rectFromStrRegExp(str, rect);
+			else
+				QtnPropertyQRect::rectFromStr(str, rect);
+			result.append(rect);
+		}
+	}
+
+	QCOMPARE(result, expected);
+}
+
+static int countProperties(const QtnPropertyBase *property)
+{
+	int result = 1;
+	auto set = property->asPropertySet();
+	if (set)
+	{
+		for (auto child : set->childProperties())
+			result += countProperties(child);
+	}
+
+	return result;
+}
+
+void TestProperty::memoryUsage()
+{
+	QtnPropertySetAllPropertyTypes pp(this);
+
+	auto usage = pp.memoryUsage();
+	QCOMPARE(usage.category(QtnMemoryUsage::Properties).count,
+		qint64(countProperties(&pp)));
+	QVERIFY(usage.category(QtnMemoryUsage::Properties).bytes >
+		qint64(sizeof(QtnPropertyBase)));
+	QVERIFY(usage.category(QtnMemoryUsage::Strings).bytes > 0);
+	QVERIFY(usage.totalBytes() >=
+		usage.category(QtnMemoryUsage::Properties).bytes);
+
+	auto &classes = usage.propertyClasses();
+	QVERIFY(classes.contains("QtnPropertySetAllPropertyTypes"));
+	QCOMPARE(classes.value("QtnPropertySetAllPropertyTypes").count, qint64(1));
+	QVERIFY(classes.value("QtnPropertyInt").count > 0);
+	QVERIFY(usage.toString().contains("QtnPropertyInt"));
+
+	QtnPropertySetAllPropertyTypes pp2(this);
+	auto usage2 = usage;
+	pp2.collectMemoryUsage(usage2);
+	QCOMPARE(usage2.category(QtnMemoryUsage::Properties).count,
+		2 * usage.category(QtnMemoryUsage::Properties).count);
+	QCOMPARE(usage2.propertyClasses().value("QtnPropertyInt").count,
+		2 * classes.value("QtnPropertyInt").count);
+}
+
+void TestProperty::varPropertyLazy()
+{
+	auto noRegister = [](QtnProperty *) {};
+
+	{
+		QVariantList list;
+		for (int i = 0; i < VarProperty::LAZY_CHUNK_SIZE + 5; i++)
+		{
+			list.append(i);
+		}
+
+		QScopedPointer<QtnPropertyBase> root(VarProperty::NewExtraProperty(
+			nullptr, list, "root", -1, nullptr, noRegister));
+		auto set = root->asPropertySet();
+		QVERIFY(set);
+
+		auto var = set->getVarProperty();
+		QVERIFY(var);
+		QVERIFY(!var->IsMaterialized());
+		QCOMPARE(var->GetChildrenCount(), list.size());
+		QCOMPARE(int(var->GetChildren().size()),
+			int(VarProperty::LAZY_CHUNK_SIZE));
+		// placeholder
+		QCOMPARE(set->childProperties().size(),
+			int(VarProperty::LAZY_CHUNK_SIZE) + 1);
+		QCOMPARE(var->CreateVariant(), QVariant(list));
+
+		QVariant data;
+		qint32 newValue = -1;
+		auto first = qobject_cast<QtnProperty *>(set->childProperties().at(0));
+		QVERIFY(VarProperty::PropertyValueAccept(first, &newValue, &data));
+		list[0] = newValue;
+		QCOMPARE(data, QVariant(list));
+
+		var->Materialize();
+		QVERIFY(var->IsMaterialized());
+		QCOMPARE(set->childProperties().size(), list.size());
+		QCOMPARE(var->CreateVariant(), QVariant(list));
+	}
+
+	{
+		QVariantList inner;
+		for (int i = 0; i < VarProperty::LAZY_CHUNK_SIZE; i++)
+		{
+			inner.append(QString::number(i));
+		}
+
+		QVariantList list;
+		for (int i = 0; i < 10; i++)
+		{
+			list.append(QVariant(inner));
+		}
+
+		QScopedPointer<QtnPropertyBase> root(VarProperty::NewExtraProperty(
+			nullptr, list, "root", -1, nullptr, noRegister));
+		auto set = root->asPropertySet();
+		QVERIFY(set);
+		QCOMPARE(set->childProperties().size(), list.size());
+
+		auto last = set->childProperties().last()->asPropertySet();
+		QVERIFY(last);
+		QVERIFY(last->isCollapsed());
+		QCOMPARE(last->childProperties().size(), 1);
+
+		auto var = last->getVarProperty();
+		QVERIFY(var);
+		QVERIFY(!var->IsMaterialized());
+		QCOMPARE(var->GetChildrenCount(), inner.size());
+		QVERIFY(var->GetChildren().empty());
+		QCOMPARE(set->getVarProperty()->CreateVariant(), QVariant(list));
+	}
+}
+
+void TestProperty::varPropertyWriteBack()
+{
+	QVariantMap map;
+	map.insert("a", QVariantList { 1, 2, 3 });
+	map.insert("b", QVariantList { "x", "y" });
+	map.insert("c", 5);
+
+	QScopedPointer<QtnPropertyBase> root(VarProperty::NewExtraProperty(
+		nullptr, map, "root", -1, nullptr, [](QtnProperty *) {}));
+	auto set = root->asPropertySet();
+	QVERIFY(set);
+	QCOMPARE(set->childProperties().size(), 3);
+
+	auto rootVar = set->getVarProperty();
+	auto aSet = set->childProperties().at(0)->asPropertySet();
+	QVERIFY(aSet);
+
+	QVariant data = map;
+	qint32 newValue = 20;
+	QVERIFY(VarProperty::PropertyValueAccept(
+		qobject_cast<QtnProperty *>(aSet->childProperties().at(1)), &newValue,
+		&data));
+	QCOMPARE(data.toMap().value("a"), QVariant(QVariantList { 1, 20, 3 }));
+	QCOMPARE(map.value("a"), QVariant(QVariantList { 1, 2, 3 }));
+
+	// untouched branch is still shared with the source
+	auto oldB = map.value("b").toList();
+	auto newB = data.toMap().value("b").toList();
+	QVERIFY(&oldB.at(0) == &newB.at(0));
+
+	set->childProperties().at(2)->getVarProperty()->RemoveFromParent();
+	data = rootVar->CreateVariant();
+	QVERIFY(!data.toMap().contains("c"));
+	QCOMPARE(data.toMap().value("a"), QVariant(QVariantList { 1, 20, 3 }));
+
+	auto aVar = aSet->getVarProperty();
+	aVar->AddChild(3, QVariant(4));
+	QCOMPARE(rootVar->CreateVariant().toMap().value("a"),
+		QVariant(QVariantList { 1, 20, 3, 4 }));
+
+	aVar->BeginUpdate();
+	aVar->AddChild(4, QVariant(5));
+	aVar->AddChild(5, QVariant(6));
+	aVar->EndUpdate();
+	QCOMPARE(rootVar->CreateVariant().toMap().value("a"),
+		QVariant(QVariantList { 1, 20, 3, 4, 5, 6 }));
+
+	// properties and var children outliving a destroyed var are unlinked
+	auto bSet = set->childProperties().at(1)->asPropertySet();
+	QVERIFY(bSet);
+	auto bVar = bSet->getVarProperty();
+	QVERIFY(bVar);
+	QCOMPARE(bVar->VarParent(), rootVar);
+	auto xVar = bSet->childProperties().at(0)->getVarProperty();
+	QVERIFY(xVar);
+
+	delete rootVar;
+	QVERIFY(set->getVarProperty() == nullptr);
+	QVERIFY(bVar->VarParent() == nullptr);
+	QCOMPARE(bSet->getVarProperty(), bVar);
+
+	delete bVar;
+	QVERIFY(bSet->getVarProperty() == nullptr);
+	QVERIFY(xVar->VarParent() == nullptr);
+}
+
 void TestProperty::qObjectProperty()
 {
 	{
@@ -1713,6 +2425,346 @@ void TestProperty::qObjectPropertySet()
 	}
 }
 
+void TestProperty::delegateInfoInterning()
+{
+	QCOMPARE(qtnDelegateAttributeId(qtnSuffixAttr()), int(QtnSuffixAttrId));
+	QCOMPARE(qtnDelegateAttributeName(QtnDrawTextAttrId), qtnDrawTextAttr());
+	int customId = qtnDelegateAttributeId("testCustomAttr");
+	QVERIFY(customId >= QtnBuiltInAttrIdCount);
+	QCOMPARE(qtnDelegateAttributeId("testCustomAttr"), customId);
+
+	QtnPropertyDelegateInfo info;
+	info.name = "SpinBox";
+	info.attributes[qtnSuffixAttr()] = QStringLiteral(" px");
+	info.attributes[qtnMinAttr()] = 1;
+	info.attributes["testCustomAttr"] = true;
+	QVERIFY(!info.isInterned());
+	QCOMPARE(info.getAttribute(QtnSuffixAttrId, QString()), QString(" px"));
+	QCOMPARE(info.getAttribute(customId, false), true);
+	QCOMPARE(info.getAttribute(QtnMaxAttrId, 5), 5);
+
+	auto interned = info.interned();
+	QVERIFY(interned);
+	QVERIFY(interned->isInterned());
+	QCOMPARE(interned->getAttribute(QtnSuffixAttrId, QString()),
+		QString(" px"));
+	QCOMPARE(interned->attributeValue(QtnMinAttrId), QVariant(1));
+	QCOMPARE(interned->getAttribute(customId, false), true);
+	QVERIFY(!interned->attribute(QtnMaxAttrId));
+
+	QtnPropertyDelegateInfo copy(info);
+	QCOMPARE(copy, info);
+	QCOMPARE(copy.interned().get(), interned.get());
+	QCOMPARE(qHash(copy), qHash(*interned));
+
+	copy.attributes[qtnMinAttr()] = 2;
+	QVERIFY(copy != info);
+	QVERIFY(copy.interned().get() != interned.get());
+
+	QtnPropertyInt p1;
+	QtnPropertyInt p2;
+	p1.setDelegateInfo(info);
+	p2.setDelegateInfo(info);
+	QVERIFY(p1.delegateInfo());
+	QCOMPARE(p1.delegateInfo(), p2.delegateInfo());
+	QCOMPARE(p1.delegateInfo(), interned.get());
+
+	p2.setDelegateAttribute(qtnMaxAttr(), 10);
+	QVERIFY(p1.delegateInfo() != p2.delegateInfo());
+	QCOMPARE(p1.delegateInfo()->attributeValue(QtnMaxAttrId), QVariant());
+	QCOMPARE(p2.delegateInfo()->attributeValue(QtnMaxAttrId), QVariant(10));
+	QCOMPARE(p2.delegateInfo()->getAttribute(QtnSuffixAttrId, QString()),
+		QString(" px"));
+}
+
+void TestProperty::updateCoalescer()
+{
+	int applied = 0;
+	int value = 0;
+	auto update = [&applied, &value](int v) {
+		return [&applied, &value, v]() {
+			applied++;
+			value = v;
+		};
+	};
+
+	{
+		QtnUpdateCoalescer coalescer;
+		coalescer.setInterval(50);
+		QCOMPARE(coalescer.interval(), 50);
+
+		// first update is applied at once, next ones are coalesced
+		coalescer.post(update(1));
+		QCOMPARE(applied, 1);
+		QCOMPARE(value, 1);
+		coalescer.post(update(2));
+		coalescer.post(update(3));
+		QVERIFY(coalescer.hasPending());
+		QCOMPARE(applied, 1);
+
+		QTRY_COMPARE(applied, 2);
+		QCOMPARE(value, 3);
+		QVERIFY(!coalescer.hasPending());
+	}
+
+	{
+		QtnUpdateCoalescer coalescer;
+		coalescer.setInterval(100000);
+		coalescer.post(update(4));
+		coalescer.post(update(5));
+		coalescer.post(update(6));
+		QCOMPARE(applied, 3);
+		coalescer.flush();
+		QCOMPARE(applied, 4);
+		QCOMPARE(value, 6);
+
+		coalescer.post(update(7));
+		coalescer.cancel();
+		QVERIFY(!coalescer.hasPending());
+		coalescer.post(update(8));
+		QVERIFY(coalescer.hasPending());
+	}
+
+	// pending update is dropped on destruction
+	QCOMPARE(applied, 4);
+	QCOMPARE(value, 6);
+
+	{
+		QtnUpdateCoalescer coalescer;
+		coalescer.setInterval(0);
+		coalescer.post(update(9));
+		coalescer.post(update(10));
+		QCOMPARE(applied, 6);
+		QCOMPARE(value, 10);
+	}
+
+	int defaultInterval = QtnUpdateCoalescer::defaultInterval();
+	QtnUpdateCoalescer::setDefaultInterval(40);
+	{
+		QtnUpdateCoalescer coalescer;
+		QCOMPARE(coalescer.interval(), 40);
+		coalescer.setInterval(-1);
+		QCOMPARE(coalescer.interval(), 40);
+	}
+	QtnUpdateCoalescer::setDefaultInterval(defaultInterval);
+}
+
+void TestProperty::enumFlagsLazySubProperties()
+{
+	QtnPropertyEnumFlags p(this);
+	p.setEnumInfo(&MASK::info());
+	p.setValue(MASK::ONE | MASK::FOUR);
+
+	QtnPropertyDelegateEnumFlags delegate(p);
+	QVERIFY(delegate.hasLazySubProperties());
+	QCOMPARE(delegate.subPropertyCount(), 3);
+
+	auto flag = qobject_cast<QtnPropertyBoolBase *>(delegate.subProperty(2));
+	QVERIFY(flag);
+	QCOMPARE(flag->name(), QString("FOUR"));
+	QVERIFY(flag->value());
+	QVERIFY(flag->setValue(false));
+	QCOMPARE(p.value(), QtnEnumFlagsValueType(MASK::ONE));
+
+	QPointer<QtnPropertyBase> released(flag);
+	delegate.releaseSubProperties();
+	QVERIFY(!released);
+
+	// created again on next request
+	QCOMPARE(delegate.subPropertyCount(), 3);
+	QVERIFY(delegate.subProperty(0) != nullptr);
+}
+
+void TestProperty::enumFlagsLookup()
+{
+	QVector<QtnEnumValueInfo> values;
+	values.append(QtnEnumValueInfo(4, "C"));
+	values.append(QtnEnumValueInfo(1, "A"));
+	values.append(QtnEnumValueInfo(3, "AB"));
+	QtnEnumInfo info("Test", values);
+	QCOMPARE(info.getCaseSensitivity(), Qt::CaseInsensitive);
+
+	// same order as in enum info
+	QCOMPARE(info.flagsToStr(5), QString("C|A|AB"));
+	QCOMPARE(info.flagsToStr(5), QString("C|A|AB"));
+	QCOMPARE(info.flagsToStr(2), QString("AB"));
+	QCOMPARE(info.flagsToStr(8), QString());
+
+	QVector<const QtnEnumValueInfo *> flagValues;
+	info.collectFlagValues(6, flagValues);
+	QCOMPARE(flagValues.size(), 2);
+	QCOMPARE(flagValues.at(0)->name(), QString("C"));
+	QCOMPARE(flagValues.at(1)->name(), QString("AB"));
+
+	auto ab = info.findByName("ab");
+	QVERIFY(ab);
+	QCOMPARE(ab->value(), 3);
+	info.setCaseSensitivity(Qt::CaseSensitive);
+	QVERIFY(!info.findByName("ab"));
+
+	// lookup table is rebuilt after modification
+	info.getVector().append(QtnEnumValueInfo(8, "D"));
+	QCOMPARE(info.flagsToStr(8), QString("D"));
+	QVERIFY(info.findByName("D"));
+
+	QtnEnumFlagsValueType flags = 0;
+	QVERIFY(QtnPropertyEnumFlags::flagsFromStr(info, "D|C", flags));
+	QCOMPARE(flags, QtnEnumFlagsValueType(12));
+	QCOMPARE(info.flagsToStr(flags), QString("C|D"));
+}
+
+void TestProperty::enumRegistry()
+{
+	static int builds = 0;
+	int id = QtnEnumRegistry::registerEnum([]() -> QtnEnumInfo {
+		builds++;
+		QVector<QtnEnumValueInfo> items;
+		items.append(QtnEnumValueInfo(1, "ONE", QString::number(builds)));
+		return QtnEnumInfo("RegistryTest", items);
+	});
+	QCOMPARE(builds, 1);
+
+	auto &info = QtnEnumRegistry::enumInfo(id);
+	QCOMPARE(&QtnEnumRegistry::enumInfo(id), &info);
+	QCOMPARE(info.findByValue(1)->displayName(), QString("1"));
+
+	auto penStyle = &QtnPropertyQPenBase::penStyleEnum();
+	QVERIFY(penStyle->findByValue(Qt::DashLine));
+	QVERIFY(!penStyle->findByValue(Qt::MPenStyle));
+
+	QtnEnumRegistry::retranslate();
+	QCOMPARE(builds, 2);
+
+	auto &newInfo = QtnEnumRegistry::enumInfo(id);
+	QVERIFY(&newInfo != &info);
+	QCOMPARE(newInfo.findByValue(1)->displayName(), QString("2"));
+	// replaced enum info is still alive
+	QCOMPARE(info.findByValue(1)->displayName(), QString("1"));
+
+	auto newPenStyle = &QtnPropertyQPenBase::penStyleEnum();
+	QVERIFY(newPenStyle != penStyle);
+	QCOMPARE(newPenStyle->getVector().size(), penStyle->getVector().size());
+
+	// concurrent readers
+	std::thread thread([]() {
+		for (int i = 0; i < 1000; i++)
+		{
+			QPen pen;
+			QtnPropertyQPenBase::penFromStr(
+				"#0000ff, DashLine, 3, SquareCap, BevelJoin", pen);
+		}
+	});
+	for (int i = 0; i < 10; i++)
+		QtnEnumRegistry::retranslate();
+	thread.join();
+}
+
+void TestProperty::rowLayout()
+{
+	QtnRowLayout layout;
+	QCOMPARE(layout.count(), 0);
+	QCOMPARE(layout.totalHeight(), 0);
+	QCOMPARE(layout.rowAt(0), -1);
+
+	QVector<int> heights;
+	for (int i = 0; i < 1000; i++)
+		heights.append(10 + (i * 7) % 23);
+
+	layout.reset(heights);
+	QCOMPARE(layout.count(), heights.size());
+
+	auto check = [&heights, &layout]() {
+		int top = 0;
+		for (int i = 0, n = heights.size(); i < n; i++)
+		{
+			QCOMPARE(layout.height(i), heights.at(i));
+			QCOMPARE(layout.top(i), top);
+			QCOMPARE(layout.rowAt(top), i);
+			QCOMPARE(layout.rowAt(top + heights.at(i) - 1), i);
+			top += heights.at(i);
+		}
+		QCOMPARE(layout.top(heights.size()), top);
+		QCOMPARE(layout.totalHeight(), top);
+		QCOMPARE(layout.rowAt(top), -1);
+		QCOMPARE(layout.rowAt(-1), -1);
+	};
+	check();
+
+	for (int i = 0; i < heights.size(); i += 37)
+	{
+		heights[i] = 1 + i % 50;
+		layout.setHeight(i, heights.at(i));
+	}
+	check();
+
+	heights.resize(1);
+	layout.reset(heights);
+	check();
+
+	layout.clear();
+	QCOMPARE(layout.count(), 0);
+	QCOMPARE(layout.rowAt(0), -1);
+}
+
+void TestProperty::animationClock()
+{
+	QVERIFY(!QtnAnimationClock::forWidget(nullptr));
+
+	std::unique_ptr<QWidget> viewport(new QWidget);
+	QWidget otherViewport;
+
+	// one clock per widget
+	auto clock = QtnAnimationClock::forWidget(viewport.get());
+	QVERIFY(clock);
+	QVERIFY(clock->parent() == viewport.get());
+	QCOMPARE(QtnAnimationClock::forWidget(viewport.get()), clock);
+	auto otherClock = QtnAnimationClock::forWidget(&otherViewport);
+	QVERIFY(otherClock);
+	QVERIFY(otherClock != clock);
+
+	int a = 0;
+	int b = 0;
+	int ticksA = 0;
+	double valueA = -1.0;
+	double valueB = -1.0;
+	auto handlerA = [&ticksA, &valueA](double value) -> QRect {
+		ticksA++;
+		valueA = value;
+		return QRect(0, 0, 10, 10);
+	};
+
+	clock->start(&a, 0.0, 1.0, 50, QEasingCurve::Linear, handlerA);
+	clock->start(&b, 10.0, 20.0, 100000, QEasingCurve::Linear,
+		[&valueB](double value) -> QRect {
+			valueB = value;
+			return QRect();
+		});
+	QCOMPARE(clock->runningCount(), 2);
+	QVERIFY(clock->isRunning(&a));
+	QVERIFY(clock->isRunning(&b));
+	QCOMPARE(otherClock->runningCount(), 0);
+
+	// restart replaces running animation of the same owner
+	clock->start(&a, 0.0, 1.0, 50, QEasingCurve::Linear, handlerA);
+	QCOMPARE(clock->runningCount(), 2);
+
+	// finished animation is removed after its last value is applied
+	QTRY_VERIFY(!clock->isRunning(&a));
+	QVERIFY(ticksA > 0);
+	QCOMPARE(valueA, 1.0);
+	QVERIFY(clock->isRunning(&b));
+	QVERIFY(valueB >= 10.0 && valueB < 20.0);
+
+	clock->stop(&b);
+	QCOMPARE(clock->runningCount(), 0);
+	QVERIFY(!clock->isRunning(&b));
+
+	// clock is destroyed with its widget
+	QPointer<QtnAnimationClock> guard(clock);
+	viewport.reset();
+	QVERIFY(guard.isNull());
+}
+
 void TestProperty::checkPropertyStateIsNonSimple(
 	QtnPropertyChangeReason reason, QtnPropertyValuePtr newValue, int typeId)
 {
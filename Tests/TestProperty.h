@@ -15,11 +15,13 @@ private Q_SLOTS:
 
 	void name();
 	void description();
+	void metadata();
 	void id();
 	void state();
 	void stateChange();
 	void propertyDelegate();
 	void propertyDelegateCallback();
+	void propertyDelegateFactory();
 	void propertyBool();
 	void propertyInt();
 	void propertyString();
@@ -39,8 +41,25 @@ private Q_SLOTS:
 	void propertyScripting();
 	void variantConversions();
 	void stringConversions();
+	void cborConversions();
+	void numberConversions();
+	void numberConversionsBenchmark_data();
+	void numberConversionsBenchmark();
+	void stringParsers();
+	void compositeParseBenchmark_data();
+	void compositeParseBenchmark();
+	void memoryUsage();
+	void varPropertyLazy();
+	void varPropertyWriteBack();
 	void qObjectProperty();
 	void qObjectPropertySet();
+	void delegateInfoInterning();
+	void updateCoalescer();
+	void enumFlagsLazySubProperties();
+	void enumFlagsLookup();
+	void enumRegistry();
+	void rowLayout();
+	void animationClock();
 
 public Q_SLOTS:
 
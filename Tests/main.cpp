@@ -2,12 +2,16 @@
 #include "TestGeneratedProperty.h"
 #include "TestEnum.h"
 #include <QtTest/QtTest>
+#include <QApplication>
 #include <QDebug>
 
 int main(int argc, char *argv[])
 {
 	qInfo("Init tests...");
-	QCoreApplication app(argc, argv);
+	// property view tests run without a display
+	if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+		qputenv("QT_QPA_PLATFORM", "offscreen");
+	QApplication app(argc, argv);
 
 	int result = 0;
 